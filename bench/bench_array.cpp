@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+#include "Array.h"
+#include "Point.h"
+#include <ostream>
+#include <sstream>
+
+template<Scalar T>
+static Array<Point<T>> make_points(size_t count) {
+    Array<Point<T>> points(count);
+    for (size_t i = 0; i < count; ++i) {
+        points.push_back(Point<T>(static_cast<T>(i % 1000), static_cast<T>(i % 777)));
+    }
+    return points;
+}
+
+template<Scalar T>
+static void BM_ArrayPushBack(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        Array<Point<T>> points;
+        for (size_t i = 0; i < count; ++i) {
+            points.push_back(Point<T>(static_cast<T>(i), static_cast<T>(i)));
+        }
+        benchmark::DoNotOptimize(points.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<Scalar T>
+static void BM_ArrayRemove(benchmark::State& state) {
+    Array<Point<T>> points = make_points<T>(static_cast<size_t>(state.range(0)));
+    size_t middle = points.size() / 2;
+    for (auto _ : state) {
+        points.remove(middle);
+        points.push_back(Point<T>(1, 2));
+        benchmark::ClobberMemory();
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+template<Scalar T>
+static void BM_ArrayCopy(benchmark::State& state) {
+    Array<Point<T>> points = make_points<T>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        Array<Point<T>> copy(points);
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(Point<T>)));
+}
+
+template<Scalar T>
+static void BM_ArrayFormat(benchmark::State& state) {
+    Array<Point<T>> points = make_points<T>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::ostringstream os;
+        os << points;
+        benchmark::DoNotOptimize(os.tellp());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define FIGURES_ARRAY_BENCHMARKS(T)                                                                \
+    BENCHMARK_TEMPLATE(BM_ArrayPushBack, T)->RangeMultiplier(10)->Range(10, 10000000);             \
+    BENCHMARK_TEMPLATE(BM_ArrayRemove, T)->RangeMultiplier(10)->Range(10, 10000000)->Complexity(); \
+    BENCHMARK_TEMPLATE(BM_ArrayCopy, T)->RangeMultiplier(10)->Range(10, 10000000);                 \
+    BENCHMARK_TEMPLATE(BM_ArrayFormat, T)->RangeMultiplier(10)->Range(10, 1000000)
+
+FIGURES_ARRAY_BENCHMARKS(int);
+FIGURES_ARRAY_BENCHMARKS(float);
+FIGURES_ARRAY_BENCHMARKS(double);
@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+#include "AffineTransform.h"
+#include "FigureCollision.h"
+#include "FigureStore.h"
+#include "FigureTransform.h"
+#include "SweepAndPrune.h"
+#include "ThreadPool.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+static FigureStore<double> make_scene(size_t count) {
+    std::mt19937 rng(23);
+    double side = std::sqrt(static_cast<double>(count)) * 4.0;
+    std::uniform_real_distribution<double> coordinate(0.0, side);
+    std::uniform_real_distribution<double> extent(0.5, 3.0);
+    FigureStore<double> store;
+    store.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        store.push_back(RectangleValue<double>(Point<double>(coordinate(rng), coordinate(rng)), extent(rng), extent(rng)));
+    }
+    return store;
+}
+
+static void BM_BruteForcePairs(benchmark::State& state) {
+    FigureStore<double> store = make_scene(static_cast<size_t>(state.range(0)));
+    std::vector<BoundingBox<double>> boxes;
+    for (size_t i = 0; i < store.size(); ++i) {
+        boxes.push_back(store.bounding_box(i));
+    }
+    for (auto _ : state) {
+        std::vector<FigurePair> pairs;
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            for (size_t j = i + 1; j < boxes.size(); ++j) {
+                if (boxes[i].intersects(boxes[j])) {
+                    pairs.push_back(FigurePair{i, j});
+                }
+            }
+        }
+        benchmark::DoNotOptimize(pairs.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * store.size()));
+}
+
+static void BM_SweepAndPruneBuild(benchmark::State& state) {
+    FigureStore<double> store = make_scene(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        SweepAndPrune<double> broad_phase(store);
+        benchmark::DoNotOptimize(broad_phase.candidate_pairs().size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * store.size()));
+}
+
+static void BM_SweepAndPruneIncremental(benchmark::State& state) {
+    FigureStore<double> store = make_scene(static_cast<size_t>(state.range(0)));
+    SweepAndPrune<double> broad_phase(store);
+    double direction = 0.05;
+    for (auto _ : state) {
+        transform_figures(store, AffineTransform::rotation(1e-4).then(AffineTransform::translation(direction, 0.0)));
+        direction = -direction;
+        broad_phase.update(store);
+        benchmark::DoNotOptimize(broad_phase.candidate_pairs().size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * store.size()));
+}
+
+static void BM_OverlappingPairs(benchmark::State& state) {
+    FigureStore<double> store = make_scene(static_cast<size_t>(state.range(0)));
+    SweepAndPrune<double> broad_phase(store);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(overlapping_pairs(store, broad_phase).size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * store.size()));
+}
+
+static void BM_OverlappingPairsParallel(benchmark::State& state) {
+    FigureStore<double> store = make_scene(static_cast<size_t>(state.range(0)));
+    SweepAndPrune<double> broad_phase(store);
+    ThreadPool pool(static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(overlapping_pairs(store, broad_phase, pool).size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * store.size()));
+}
+
+BENCHMARK(BM_BruteForcePairs)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SweepAndPruneBuild)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SweepAndPruneIncremental)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OverlappingPairs)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OverlappingPairsParallel)->ArgsProduct({{100000}, {1, 2, 4, 8}})->UseRealTime()->Unit(benchmark::kMillisecond);
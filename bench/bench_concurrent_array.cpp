@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include "Array.h"
+#include "ConcurrentArray.h"
+#include "RectangleValue.h"
+#include "ThreadPool.h"
+#include <mutex>
+
+static constexpr size_t figures_per_run = size_t(1) << 20;
+
+static RectangleValue<double> make_value(size_t i) {
+    return RectangleValue<double>(Point<double>(static_cast<double>(i % 1000), static_cast<double>(i % 777)), 4.0, 6.0);
+}
+
+static void BM_MutexArrayIngest(benchmark::State& state) {
+    size_t producers = static_cast<size_t>(state.range(0));
+    ThreadPool pool(producers);
+    for (auto _ : state) {
+        Array<RectangleValue<double>> figures;
+        std::mutex mutex;
+        pool.parallel_for(producers, [&](size_t producer) {
+            for (size_t i = producer; i < figures_per_run; i += producers) {
+                RectangleValue<double> value = make_value(i);
+                std::lock_guard<std::mutex> lock(mutex);
+                figures.push_back(value);
+            }
+        });
+        benchmark::DoNotOptimize(figures.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * figures_per_run));
+}
+
+static void BM_ConcurrentArrayIngest(benchmark::State& state) {
+    size_t producers = static_cast<size_t>(state.range(0));
+    ThreadPool pool(producers);
+    for (auto _ : state) {
+        ConcurrentArray<RectangleValue<double>> figures;
+        pool.parallel_for(producers, [&](size_t producer) {
+            for (size_t i = producer; i < figures_per_run; i += producers) {
+                figures.push_back(make_value(i));
+            }
+        });
+        benchmark::DoNotOptimize(figures.size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * figures_per_run));
+}
+
+static void BM_ConcurrentArrayIngestAndFreeze(benchmark::State& state) {
+    size_t producers = static_cast<size_t>(state.range(0));
+    ThreadPool pool(producers);
+    for (auto _ : state) {
+        ConcurrentArray<RectangleValue<double>> figures(figures_per_run);
+        pool.parallel_for(producers, [&](size_t producer) {
+            for (size_t i = producer; i < figures_per_run; i += producers) {
+                figures.push_back(make_value(i));
+            }
+        });
+        Array<RectangleValue<double>> frozen = std::move(figures).freeze();
+        benchmark::DoNotOptimize(frozen.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * figures_per_run));
+}
+
+BENCHMARK(BM_MutexArrayIngest)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ConcurrentArrayIngest)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ConcurrentArrayIngestAndFreeze)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
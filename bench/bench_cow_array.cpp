@@ -0,0 +1,46 @@
+#include <benchmark/benchmark.h>
+#include "Array.h"
+#include "CowArray.h"
+#include "Rectangle.h"
+#include <memory>
+
+template<class Container>
+static Container make_figures(size_t count) {
+    Container figures;
+    figures.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        double offset = static_cast<double>(i);
+        figures.push_back(std::make_shared<Rectangle<double>>(Point<double>(offset, offset), 4.0, 3.0));
+    }
+    return figures;
+}
+
+template<class Container>
+static void BM_CopyFigureArray(benchmark::State& state) {
+    Container figures = make_figures<Container>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        Container copy(figures);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Container>
+static void BM_CopyAndMutate(benchmark::State& state) {
+    Container figures = make_figures<Container>(static_cast<size_t>(state.range(0)));
+    auto extra = std::make_shared<Rectangle<double>>(Point<double>(0.0, 0.0), 1.0, 1.0);
+    for (auto _ : state) {
+        Container copy(figures);
+        copy.push_back(extra);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+using FigureArray = Array<std::shared_ptr<Figure<double>>>;
+using FigureCowArray = CowArray<std::shared_ptr<Figure<double>>>;
+
+BENCHMARK_TEMPLATE(BM_CopyFigureArray, FigureArray)->RangeMultiplier(10)->Range(10, 1000000)->Complexity();
+BENCHMARK_TEMPLATE(BM_CopyFigureArray, FigureCowArray)->RangeMultiplier(10)->Range(10, 1000000)->Complexity();
+BENCHMARK_TEMPLATE(BM_CopyAndMutate, FigureArray)->RangeMultiplier(10)->Range(10, 1000000)->Complexity();
+BENCHMARK_TEMPLATE(BM_CopyAndMutate, FigureCowArray)->RangeMultiplier(10)->Range(10, 1000000)->Complexity();
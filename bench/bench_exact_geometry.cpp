@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+#include "ExactGeometry.h"
+#include "FigureStore.h"
+#include "Rectangle.h"
+#include "SimdKernels.h"
+#include <array>
+#include <random>
+#include <vector>
+
+static std::vector<std::array<Point<int>, 4>> make_int_quads(size_t count) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> coordinate(-100000, 100000);
+    std::uniform_int_distribution<int> extent(1, 500);
+    std::vector<std::array<Point<int>, 4>> quads(count);
+    for (auto& quad : quads) {
+        int x = coordinate(rng), y = coordinate(rng);
+        int dx = extent(rng), dy = extent(rng);
+        quad = {Point<int>(x, y), Point<int>(x + dx, y + dy), Point<int>(x + dx - dy, y + dy + dx), Point<int>(x - dy, y + dx)};
+    }
+    return quads;
+}
+
+static void BM_IntAreaDistance(benchmark::State& state) {
+    auto quads = make_int_quads(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        double total = 0.0;
+        for (const auto& quad : quads) {
+            total += quad[0].distance(quad[1]) * quad[1].distance(quad[2]);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * quads.size()));
+}
+
+static void BM_IntAreaShoelace(benchmark::State& state) {
+    auto quads = make_int_quads(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        double total = 0.0;
+        for (const auto& quad : quads) {
+            total += exact_area<int>(quad);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * quads.size()));
+}
+
+static FigureStore<int> make_int_store(size_t count) {
+    FigureStore<int> store;
+    store.reserve(count);
+    for (const auto& quad : make_int_quads(count)) {
+        store.push_back(RectangleValue<int>::from_validated(quad));
+    }
+    return store;
+}
+
+static void BM_IntStoreAreasAvx2Double(benchmark::State& state) {
+    FigureStore<int> store = make_int_store(static_cast<size_t>(state.range(0)));
+    std::vector<double> areas(store.size());
+    for (auto _ : state) {
+        size_t done = 0;
+#if FIGURES_SIMD_X86
+        if (detected_simd_level() == SimdLevel::AVX2) {
+            done = simd_detail::avx2_areas(store.columns(), areas.data());
+        }
+#endif
+        simd_detail::scalar_areas(store.columns(), done, areas.data());
+        benchmark::DoNotOptimize(areas.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * store.size()));
+}
+
+static void BM_IntStoreAreasExact(benchmark::State& state) {
+    FigureStore<int> store = make_int_store(static_cast<size_t>(state.range(0)));
+    std::vector<double> areas(store.size());
+    for (auto _ : state) {
+        store.areas(areas.data());
+        benchmark::DoNotOptimize(areas.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * store.size()));
+}
+
+BENCHMARK(BM_IntAreaDistance)->RangeMultiplier(100)->Range(100, 1000000);
+BENCHMARK(BM_IntAreaShoelace)->RangeMultiplier(100)->Range(100, 1000000);
+BENCHMARK(BM_IntStoreAreasAvx2Double)->RangeMultiplier(100)->Range(100, 1000000);
+BENCHMARK(BM_IntStoreAreasExact)->RangeMultiplier(100)->Range(100, 1000000);
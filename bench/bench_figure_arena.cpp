@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+#include "AllocationCounter.h"
+#include "Array.h"
+#include "FigureArena.h"
+#include "Rectangle.h"
+#include "Trapezoid.h"
+#include "Rhombus.h"
+#include "ThreadPool.h"
+#include <memory>
+#include <vector>
+
+static constexpr size_t figures_per_batch = 4096;
+
+template<class Figures, class Make>
+static void fill_batch(Figures& figures, Make&& make) {
+    for (size_t i = 0; i < figures_per_batch; ++i) {
+        Point<double> center(static_cast<double>(i % 1000), static_cast<double>(i % 777));
+        switch (i % 3) {
+            case 0:
+                figures.push_back(make.template operator()<Rectangle<double>>(center, 4.0, 6.0));
+                break;
+            case 1:
+                figures.push_back(make.template operator()<Trapezoid<double>>(center, 6.0, 4.0, 2.0));
+                break;
+            default:
+                figures.push_back(make.template operator()<Rhombus<double>>(center, 6.0, 4.0));
+                break;
+        }
+    }
+}
+
+static void report_allocations(benchmark::State& state, size_t before, size_t batches) {
+    state.counters["allocs_per_figure"] = benchmark::Counter(
+        static_cast<double>(allocation_count() - before) / 
+        static_cast<double>(state.iterations() * batches * figures_per_batch));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * batches * figures_per_batch));
+}
+
+static void BM_BatchGlobalAllocator(benchmark::State& state) {
+    ThreadPool pool(static_cast<size_t>(state.range(0)));
+    size_t batches = static_cast<size_t>(state.range(1));
+    size_t before = allocation_count();
+    for (auto _ : state) {
+        pool.parallel_for(batches, [](size_t) {
+            Array<std::shared_ptr<Figure<double>>> figures(figures_per_batch);
+            fill_batch(figures, []<class Shape>(auto&&... args) {
+                return std::make_shared<Shape>(std::forward<decltype(args)>(args)...);
+            });
+            benchmark::DoNotOptimize(figures.data());
+        });
+    }
+    report_allocations(state, before, batches);
+}
+
+static void BM_BatchArenaShared(benchmark::State& state) {
+    ThreadPool pool(static_cast<size_t>(state.range(0)));
+    size_t batches = static_cast<size_t>(state.range(1));
+    size_t before = allocation_count();
+    for (auto _ : state) {
+        pool.parallel_for(batches, [](size_t) {
+            FigureArena<double> arena(figures_per_batch * 160);
+            auto figures = arena.make_array<std::shared_ptr<Figure<double>>>(figures_per_batch);
+            fill_batch(figures, [&arena]<class Shape>(auto&&... args) {
+                return arena.make_shared<Shape>(std::forward<decltype(args)>(args)...);
+            });
+            benchmark::DoNotOptimize(figures.data());
+        });
+    }
+    report_allocations(state, before, batches);
+}
+
+static void BM_BatchArenaRaw(benchmark::State& state) {
+    ThreadPool pool(static_cast<size_t>(state.range(0)));
+    size_t batches = static_cast<size_t>(state.range(1));
+    size_t before = allocation_count();
+    for (auto _ : state) {
+        pool.parallel_for(batches, [](size_t) {
+            FigureArena<double> arena(figures_per_batch * 160);
+            auto figures = arena.make_array<Figure<double>*>(figures_per_batch);
+            fill_batch(figures, [&arena]<class Shape>(auto&&... args) {
+                return static_cast<Figure<double>*>(arena.create<Shape>(std::forward<decltype(args)>(args)...));
+            });
+            benchmark::DoNotOptimize(figures.data());
+        });
+    }
+    report_allocations(state, before, batches);
+}
+
+BENCHMARK(BM_BatchGlobalAllocator)->ArgsProduct({{1, 2, 4, 8}, {64}})->UseRealTime();
+BENCHMARK(BM_BatchArenaShared)->ArgsProduct({{1, 2, 4, 8}, {64}})->UseRealTime();
+BENCHMARK(BM_BatchArenaRaw)->ArgsProduct({{1, 2, 4, 8}, {64}})->UseRealTime();
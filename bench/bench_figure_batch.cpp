@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+#include "FigureBatch.h"
+#include "FigureStore.h"
+#include "Rectangle.h"
+#include "ValidityBitmap.h"
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+static std::vector<double> make_candidates(size_t count) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+    std::uniform_real_distribution<double> extent(0.5, 50.0);
+    std::vector<double> coordinates;
+    coordinates.reserve(count * 8);
+    for (size_t i = 0; i < count; ++i) {
+        auto vertices = RectangleValue<double>(Point<double>(coordinate(rng), coordinate(rng)), extent(rng), extent(rng)).vertices();
+        if (i % 8 == 7) {
+            vertices[2] = Point<double>(vertices[2].x() + 0.5, vertices[2].y());
+        }
+        for (const Point<double>& vertex : vertices) {
+            coordinates.push_back(vertex.x());
+            coordinates.push_back(vertex.y());
+        }
+    }
+    return coordinates;
+}
+
+static void BM_ScalarConstructRectangles(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    std::vector<double> coordinates = make_candidates(count);
+    for (auto _ : state) {
+        FigureStore<double> store;
+        store.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            const double* c = coordinates.data() + i * 8;
+            try {
+                store.push_back(Rectangle<double>(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7]));
+            } catch (const std::invalid_argument&) {
+            }
+        }
+        benchmark::DoNotOptimize(store.size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+static void BM_BatchValidateRectangles(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    SimdLevel level = static_cast<SimdLevel>(state.range(1));
+    std::vector<double> coordinates = make_candidates(count);
+    for (auto _ : state) {
+        ValidityBitmap valid = batch_validate<double>(FigureKind::Rectangle, coordinates, level);
+        benchmark::DoNotOptimize(valid.word(0));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+static void BM_BatchAppendRectangles(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    SimdLevel level = static_cast<SimdLevel>(state.range(1));
+    std::vector<double> coordinates = make_candidates(count);
+    for (auto _ : state) {
+        FigureStore<double> store;
+        ValidityBitmap valid = batch_append(FigureKind::Rectangle, coordinates, store, level);
+        benchmark::DoNotOptimize(store.size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+BENCHMARK(BM_ScalarConstructRectangles)->RangeMultiplier(100)->Range(1000, 10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BatchValidateRectangles)
+    ->ArgsProduct({{1000, 100000, 10000000},
+                   {static_cast<int64_t>(SimdLevel::Scalar), static_cast<int64_t>(SimdLevel::AVX2)}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BatchAppendRectangles)
+    ->ArgsProduct({{1000, 100000, 10000000},
+                   {static_cast<int64_t>(SimdLevel::Scalar), static_cast<int64_t>(SimdLevel::AVX2)}})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+#include "Array.h"
+#include "FigureCacheStats.h"
+#include "Rectangle.h"
+#include "Trapezoid.h"
+#include "Rhombus.h"
+#include <memory>
+#include <sstream>
+
+static Array<std::shared_ptr<Figure<double>>> make_mixed_figures(size_t count) {
+    Array<std::shared_ptr<Figure<double>>> figures(count);
+    for (size_t i = 0; i < count; ++i) {
+        Point<double> center(static_cast<double>(i % 1000), static_cast<double>(i % 777));
+        switch (i % 3) {
+            case 0:
+                figures.push_back(std::make_shared<Rectangle<double>>(center, 4.0, 6.0));
+                break;
+            case 1:
+                figures.push_back(std::make_shared<Trapezoid<double>>(center, 6.0, 4.0, 2.0));
+                break;
+            default:
+                figures.push_back(std::make_shared<Rhombus<double>>(center, 6.0, 4.0));
+                break;
+        }
+    }
+    return figures;
+}
+
+static void report_hit_rate(benchmark::State& state) {
+    FigureCacheStats stats = FigureCacheCounters::snapshot();
+    state.counters["hit_rate"] = stats.hit_rate();
+}
+
+static void BM_ColdAreaCenter(benchmark::State& state) {
+    FigureCacheCounters::reset();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto fresh = make_mixed_figures(static_cast<size_t>(state.range(0)));
+        state.ResumeTiming();
+        double total = 0.0;
+        for (size_t i = 0; i < fresh.size(); ++i) {
+            total += fresh[i]->area() + fresh[i]->center().x();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    report_hit_rate(state);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_WarmAreaCenter(benchmark::State& state) {
+    auto figures = make_mixed_figures(static_cast<size_t>(state.range(0)));
+    FigureCacheCounters::reset();
+    for (auto _ : state) {
+        double total = 0.0;
+        for (size_t i = 0; i < figures.size(); ++i) {
+            total += figures[i]->area() + figures[i]->center().x();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    report_hit_rate(state);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_RepeatedStreamOutput(benchmark::State& state) {
+    auto figures = make_mixed_figures(static_cast<size_t>(state.range(0)));
+    FigureCacheCounters::reset();
+    for (auto _ : state) {
+        std::ostringstream out;
+        for (size_t i = 0; i < figures.size(); ++i) {
+            out << *figures[i] << ' ' << static_cast<double>(*figures[i]) << '\n';
+        }
+        benchmark::DoNotOptimize(out.tellp());
+    }
+    report_hit_rate(state);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ColdAreaCenter)->Arg(100000);
+BENCHMARK(BM_WarmAreaCenter)->Arg(100000);
+BENCHMARK(BM_RepeatedStreamOutput)->Arg(10000);
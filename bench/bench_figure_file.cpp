@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+#include "FigureFile.h"
+#include "FigureStore.h"
+#include "MappedFigureFile.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+template<Scalar T>
+static FigureStore<T> make_store(size_t count) {
+    FigureStore<T> store;
+    store.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        Point<T> center(static_cast<T>(i % 1000), static_cast<T>(i % 777));
+        switch (i % 3) {
+            case 0:
+                store.push_back(Rectangle<T>(center, 4, 6));
+                break;
+            case 1:
+                store.push_back(Trapezoid<T>(center, 6, 4, 2));
+                break;
+            default:
+                store.push_back(Rhombus<T>(center, 6, 4));
+                break;
+        }
+    }
+    return store;
+}
+
+static std::string bench_path(const char* extension) {
+    return (std::filesystem::temp_directory_path() / (std::string("figures_bench.") + extension)).string();
+}
+
+template<Scalar T>
+static void BM_LoadText(benchmark::State& state) {
+    FigureStore<T> store = make_store<T>(static_cast<size_t>(state.range(0)));
+    std::string path = bench_path("txt");
+    {
+        std::ofstream out(path);
+        for (size_t i = 0; i < store.size(); ++i) {
+            out << static_cast<int>(store.kind(i)) << ' ';
+            for (size_t k = 0; k < 4; ++k) {
+                Point<T> vertex = store.get_vertex(i, k);
+                out << vertex.x() << ' ' << vertex.y() << ' ';
+            }
+            out << '\n';
+        }
+    }
+    
+    for (auto _ : state) {
+        std::ifstream in(path);
+        FigureStore<T> loaded;
+        int kind;
+        Point<T> v[4];
+        while (in >> kind >> v[0] >> v[1] >> v[2] >> v[3]) {
+            switch (static_cast<FigureKind>(kind)) {
+                case FigureKind::Rectangle:
+                    loaded.push_back(Rectangle<T>(v[0].x(), v[0].y(), v[1].x(), v[1].y(), v[2].x(), v[2].y(), v[3].x(), v[3].y()));
+                    break;
+                case FigureKind::Trapezoid:
+                    loaded.push_back(Trapezoid<T>(v[0].x(), v[0].y(), v[1].x(), v[1].y(), v[2].x(), v[2].y(), v[3].x(), v[3].y()));
+                    break;
+                case FigureKind::Rhombus:
+                    loaded.push_back(Rhombus<T>(v[0].x(), v[0].y(), v[1].x(), v[1].y(), v[2].x(), v[2].y(), v[3].x(), v[3].y()));
+                    break;
+            }
+        }
+        benchmark::DoNotOptimize(loaded.total_area());
+    }
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<Scalar T, FigureFileValidation Validation>
+static void BM_MapFigureFile(benchmark::State& state) {
+    std::string path = bench_path("bin");
+    write_figure_file(path, make_store<T>(static_cast<size_t>(state.range(0))));
+    
+    for (auto _ : state) {
+        MappedFigureFile<T> file(path, Validation);
+        benchmark::DoNotOptimize(file.total_area());
+    }
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<Scalar T>
+static void BM_WriteFigureFile(benchmark::State& state) {
+    std::string path = bench_path("bin");
+    FigureStore<T> store = make_store<T>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        write_figure_file(path, store);
+    }
+    std::filesystem::remove(path);
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(1 + 8 * sizeof(T)));
+}
+
+#define FIGURES_FILE_BENCHMARKS(T)                                                                                         \
+    BENCHMARK_TEMPLATE(BM_LoadText, T)->Arg(1000000)->Unit(benchmark::kMillisecond);                                       \
+    BENCHMARK_TEMPLATE(BM_MapFigureFile, T, FigureFileValidation::None)->Arg(1000000)->Unit(benchmark::kMillisecond);      \
+    BENCHMARK_TEMPLATE(BM_MapFigureFile, T, FigureFileValidation::Lazy)->Arg(1000000)->Unit(benchmark::kMillisecond);      \
+    BENCHMARK_TEMPLATE(BM_MapFigureFile, T, FigureFileValidation::Eager)->Arg(1000000)->Unit(benchmark::kMillisecond);     \
+    BENCHMARK_TEMPLATE(BM_WriteFigureFile, T)->Arg(1000000)->Unit(benchmark::kMillisecond)
+
+FIGURES_FILE_BENCHMARKS(double);
+FIGURES_FILE_BENCHMARKS(float);
+FIGURES_FILE_BENCHMARKS(int);
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+#include "FigureParser.h"
+#include "FigureStore.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+template<Scalar T>
+static std::string make_text(size_t count) {
+    std::ostringstream out;
+    for (size_t i = 0; i < count; ++i) {
+        T x = static_cast<T>(i % 1000);
+        T y = static_cast<T>(i % 777);
+        switch (i % 3) {
+            case 0:
+                out << "rectangle " << x - 2 << ' ' << y - 3 << ' ' << x + 2 << ' ' << y - 3 << ' ' 
+                    << x + 2 << ' ' << y + 3 << ' ' << x - 2 << ' ' << y + 3 << '\n';
+                break;
+            case 1:
+                out << "trapezoid " << x << ' ' << y << " 6 4 2\n";
+                break;
+            default:
+                out << "rhombus " << x << ' ' << y << " 6 4\n";
+                break;
+        }
+    }
+    return out.str();
+}
+
+template<Scalar T>
+static void BM_ParseFromChars(benchmark::State& state) {
+    std::string text = make_text<T>(static_cast<size_t>(state.range(0)));
+    FigureParser<T> parser;
+    for (auto _ : state) {
+        FigureStore<T> store;
+        store.reserve(static_cast<size_t>(state.range(0)));
+        parser.parse(text, store);
+        benchmark::DoNotOptimize(store.size());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+template<Scalar T>
+static void BM_ParseFile(benchmark::State& state) {
+    std::string path = (std::filesystem::temp_directory_path() / "figures_parser_bench.txt").string();
+    std::string text = make_text<T>(static_cast<size_t>(state.range(0)));
+    std::ofstream(path) << text;
+    
+    FigureParser<T> parser;
+    for (auto _ : state) {
+        FigureStore<T> store;
+        parser.parse_file(path, store);
+        benchmark::DoNotOptimize(store.size());
+    }
+    std::filesystem::remove(path);
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+template<Scalar T>
+static void BM_ParseIstream(benchmark::State& state) {
+    std::string text = make_text<T>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::istringstream in(text);
+        FigureStore<T> store;
+        std::string kind;
+        while (in >> kind) {
+            if (kind == "rectangle") {
+                Point<T> v[4];
+                in >> v[0] >> v[1] >> v[2] >> v[3];
+                store.push_back(Rectangle<T>(v[0].x(), v[0].y(), v[1].x(), v[1].y(), v[2].x(), v[2].y(), v[3].x(), v[3].y()));
+            } else if (kind == "trapezoid") {
+                Point<T> center;
+                T base1, base2, height;
+                in >> center >> base1 >> base2 >> height;
+                store.push_back(Trapezoid<T>(center, base1, base2, height));
+            } else {
+                Point<T> center;
+                T diagonal1, diagonal2;
+                in >> center >> diagonal1 >> diagonal2;
+                store.push_back(Rhombus<T>(center, diagonal1, diagonal2));
+            }
+        }
+        benchmark::DoNotOptimize(store.size());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+#define FIGURES_PARSER_BENCHMARKS(T)                                                            \
+    BENCHMARK_TEMPLATE(BM_ParseFromChars, T)->Arg(1000000)->Unit(benchmark::kMillisecond);   \
+    BENCHMARK_TEMPLATE(BM_ParseFile, T)->Arg(1000000)->Unit(benchmark::kMillisecond);        \
+    BENCHMARK_TEMPLATE(BM_ParseIstream, T)->Arg(1000000)->Unit(benchmark::kMillisecond)
+
+FIGURES_PARSER_BENCHMARKS(double);
+FIGURES_PARSER_BENCHMARKS(float);
+FIGURES_PARSER_BENCHMARKS(int);
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+#include "Array.h"
+#include "FigureRanking.h"
+#include "FigureStore.h"
+#include "Rectangle.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+static FigureStore<double> make_ranking_store(size_t count) {
+    std::mt19937 rng(31);
+    std::uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+    std::uniform_real_distribution<double> extent(0.5, 50.0);
+    FigureStore<double> store;
+    store.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        store.push_back(RectangleValue<double>(Point<double>(coordinate(rng), coordinate(rng)), extent(rng), extent(rng)));
+    }
+    return store;
+}
+
+static const Array<std::shared_ptr<Figure<double>>>& ranking_figures(size_t count) {
+    static size_t cached_count = 0;
+    static Array<std::shared_ptr<Figure<double>>> figures;
+    if (cached_count != count) {
+        figures = Array<std::shared_ptr<Figure<double>>>();
+        figures = make_ranking_store(count).to_array();
+        cached_count = count;
+    }
+    return figures;
+}
+
+static void BM_StdSortFiguresByArea(benchmark::State& state) {
+    Array<std::shared_ptr<Figure<double>>> figures = ranking_figures(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::sort(figures.begin(), figures.end(), [](const auto& a, const auto& b) { return a->area() < b->area(); });
+        benchmark::DoNotOptimize(figures.data());
+        state.PauseTiming();
+        std::shuffle(figures.begin(), figures.end(), std::mt19937(1));
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * figures.size()));
+}
+
+static void BM_SortFiguresByArea(benchmark::State& state) {
+    Array<std::shared_ptr<Figure<double>>> figures = ranking_figures(static_cast<size_t>(state.range(0)));
+    ThreadPool pool(static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        sort_figures(figures, FigureKey::Area, pool);
+        benchmark::DoNotOptimize(figures.data());
+        state.PauseTiming();
+        std::shuffle(figures.begin(), figures.end(), std::mt19937(1));
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * figures.size()));
+}
+
+static void BM_TopKFiguresByArea(benchmark::State& state) {
+    const Array<std::shared_ptr<Figure<double>>>& figures = ranking_figures(static_cast<size_t>(state.range(0)));
+    ThreadPool pool(static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(top_k_figures(figures, 100, FigureKey::Area, pool).size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * figures.size()));
+}
+
+static void BM_StdPartialSortFiguresByArea(benchmark::State& state) {
+    Array<std::shared_ptr<Figure<double>>> figures = ranking_figures(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::partial_sort(figures.begin(), figures.begin() + 100, figures.end(),
+                          [](const auto& a, const auto& b) { return a->area() > b->area(); });
+        benchmark::DoNotOptimize(figures.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * figures.size()));
+}
+
+static void BM_SortedOrderStoreKeys(benchmark::State& state) {
+    FigureStore<double> store = make_ranking_store(static_cast<size_t>(state.range(0)));
+    ThreadPool pool(static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        std::vector<double> keys = figure_keys(store, FigureKey::Area, pool);
+        benchmark::DoNotOptimize(sorted_order(keys, pool).data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * store.size()));
+}
+
+static void BM_NthOrderStoreKeys(benchmark::State& state) {
+    FigureStore<double> store = make_ranking_store(static_cast<size_t>(state.range(0)));
+    ThreadPool pool(static_cast<size_t>(state.range(1)));
+    std::vector<double> keys = figure_keys(store, FigureKey::Area, pool);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nth_order(keys, keys.size() / 2, pool).data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * store.size()));
+}
+
+BENCHMARK(BM_StdSortFiguresByArea)->Arg(1000000)->Arg(10000000)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SortFiguresByArea)->ArgsProduct({{1000000, 10000000}, {1, 4}})->Iterations(2)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StdPartialSortFiguresByArea)->Arg(10000000)->Iterations(2)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TopKFiguresByArea)->ArgsProduct({{10000000}, {1, 4}})->Iterations(2)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SortedOrderStoreKeys)->ArgsProduct({{10000000}, {1, 4}})->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_NthOrderStoreKeys)->ArgsProduct({{10000000}, {1, 4}})->UseRealTime()->Unit(benchmark::kMillisecond);
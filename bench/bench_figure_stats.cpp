@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+#include "FigureStats.h"
+#include "FigureStore.h"
+#include "ThreadPool.h"
+#include <memory>
+
+static Array<std::shared_ptr<Figure<double>>> make_stats_figures(size_t count) {
+    Array<std::shared_ptr<Figure<double>>> figures(count);
+    for (size_t i = 0; i < count; ++i) {
+        Point<double> center(static_cast<double>(i % 1000), static_cast<double>(i % 777));
+        switch (i % 3) {
+            case 0:
+                figures.push_back(std::make_shared<Rectangle<double>>(center, 4.0, 6.0));
+                break;
+            case 1:
+                figures.push_back(std::make_shared<Trapezoid<double>>(center, 6.0, 4.0, 2.0));
+                break;
+            default:
+                figures.push_back(std::make_shared<Rhombus<double>>(center, 6.0, 4.0));
+                break;
+        }
+    }
+    return figures;
+}
+
+static void BM_SerialTotalArea(benchmark::State& state) {
+    auto figures = make_stats_figures(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        double total = 0.0;
+        for (size_t i = 0; i < figures.size(); ++i) {
+            total += static_cast<double>(*figures[i]);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_FigureStatsArray(benchmark::State& state) {
+    auto figures = make_stats_figures(static_cast<size_t>(state.range(0)));
+    ThreadPool pool(static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(figure_stats(figures, pool));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_FigureStatsStore(benchmark::State& state) {
+    FigureStore<double> store(make_stats_figures(static_cast<size_t>(state.range(0))));
+    ThreadPool pool(static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(figure_stats(store, pool));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_SerialTotalArea)->Arg(1000000)->UseRealTime();
+BENCHMARK(BM_FigureStatsArray)->ArgsProduct({{1000000}, {1, 2, 4, 8}})->UseRealTime();
+BENCHMARK(BM_FigureStatsStore)->ArgsProduct({{1000000}, {1, 2, 4, 8}})->UseRealTime();
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include "AffineTransform.h"
+#include "FigureStore.h"
+#include "FigureTransform.h"
+#include "Rectangle.h"
+#include "ThreadPool.h"
+#include <memory>
+#include <random>
+
+static FigureStore<double> make_store(size_t count) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+    std::uniform_real_distribution<double> extent(0.5, 50.0);
+    FigureStore<double> store;
+    store.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        store.push_back(RectangleValue<double>(Point<double>(coordinate(rng), coordinate(rng)), extent(rng), extent(rng)));
+    }
+    return store;
+}
+
+static const AffineTransform step = AffineTransform::rotation(1e-3).then(AffineTransform::translation(0.25, -0.25));
+
+static void BM_RebuildRectangles(benchmark::State& state) {
+    Array<std::shared_ptr<Figure<double>>> figures = make_store(static_cast<size_t>(state.range(0))).to_array();
+    for (auto _ : state) {
+        for (size_t i = 0; i < figures.size(); ++i) {
+            std::span<const Point<double>> v = figures[i]->vertices();
+            Point<double> a = step(v[0]), b = step(v[1]), c = step(v[2]), d = step(v[3]);
+            figures[i] = std::make_shared<Rectangle<double>>(a.x(), a.y(), b.x(), b.y(), c.x(), c.y(), d.x(), d.y());
+        }
+        benchmark::DoNotOptimize(figures[0].get());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * figures.size()));
+}
+
+static void BM_TransformFigureArray(benchmark::State& state) {
+    Array<std::shared_ptr<Figure<double>>> figures = make_store(static_cast<size_t>(state.range(0))).to_array();
+    for (auto _ : state) {
+        ValidityBitmap valid = transform_figures(figures, step);
+        benchmark::DoNotOptimize(valid.word(0));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * figures.size()));
+}
+
+static void BM_TransformStore(benchmark::State& state) {
+    FigureStore<double> store = make_store(static_cast<size_t>(state.range(0)));
+    SimdLevel level = static_cast<SimdLevel>(state.range(1));
+    for (auto _ : state) {
+        ValidityBitmap valid = transform_figures(store, step, level);
+        benchmark::DoNotOptimize(valid.word(0));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * store.size()));
+}
+
+static void BM_TransformStoreParallel(benchmark::State& state) {
+    FigureStore<double> store = make_store(static_cast<size_t>(state.range(0)));
+    ThreadPool pool(static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        ValidityBitmap valid = transform_figures(store, step, pool);
+        benchmark::DoNotOptimize(valid.word(0));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * store.size()));
+}
+
+BENCHMARK(BM_RebuildRectangles)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TransformFigureArray)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TransformStore)
+    ->ArgsProduct({{100000, 1000000}, {static_cast<int>(SimdLevel::Scalar), static_cast<int>(SimdLevel::AVX2)}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TransformStoreParallel)->ArgsProduct({{1000000}, {1, 2, 4, 8}})->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+#include "Array.h"
+#include "FigureVariant.h"
+#include <memory>
+
+static Array<std::shared_ptr<Figure<double>>> make_mixed_figures(size_t count) {
+    Array<std::shared_ptr<Figure<double>>> figures(count);
+    for (size_t i = 0; i < count; ++i) {
+        double offset = static_cast<double>(i % 1000);
+        Point<double> center(offset, -offset);
+        switch (i % 3) {
+            case 0:
+                figures.push_back(std::make_shared<Rectangle<double>>(center, 4.0, 3.0));
+                break;
+            case 1:
+                figures.push_back(std::make_shared<Trapezoid<double>>(center, 6.0, 4.0, 3.0));
+                break;
+            default:
+                figures.push_back(std::make_shared<Rhombus<double>>(center, 6.0, 4.0));
+                break;
+        }
+    }
+    return figures;
+}
+
+static void BM_TotalAreaVirtual(benchmark::State& state) {
+    auto figures = make_mixed_figures(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        double total = 0.0;
+        for (size_t i = 0; i < figures.size(); ++i) {
+            total += figures[i]->area();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_TotalAreaVariant(benchmark::State& state) {
+    auto figures = to_variant_array(make_mixed_figures(static_cast<size_t>(state.range(0))));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(total_area(figures));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_CenterVirtual(benchmark::State& state) {
+    auto figures = make_mixed_figures(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (size_t i = 0; i < figures.size(); ++i) {
+            sum += figures[i]->center().x();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_CenterVariant(benchmark::State& state) {
+    auto figures = to_variant_array(make_mixed_figures(static_cast<size_t>(state.range(0))));
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (size_t i = 0; i < figures.size(); ++i) {
+            sum += figures[i].center().x();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_TotalAreaVirtual)->RangeMultiplier(100)->Range(100, 1000000);
+BENCHMARK(BM_TotalAreaVariant)->RangeMultiplier(100)->Range(100, 1000000);
+BENCHMARK(BM_CenterVirtual)->RangeMultiplier(100)->Range(100, 1000000);
+BENCHMARK(BM_CenterVariant)->RangeMultiplier(100)->Range(100, 1000000);
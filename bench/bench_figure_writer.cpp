@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+#include "Array.h"
+#include "FigureFormatter.h"
+#include "FigureWriter.h"
+#include "Rectangle.h"
+#include "Trapezoid.h"
+#include "Rhombus.h"
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+
+template<Scalar T>
+static Array<std::shared_ptr<Figure<T>>> make_mixed_figures(size_t count) {
+    Array<std::shared_ptr<Figure<T>>> figures(count);
+    for (size_t i = 0; i < count; ++i) {
+        Point<T> center(static_cast<T>(i % 1000) / 3, static_cast<T>(i % 777) / 7);
+        switch (i % 3) {
+            case 0:
+                figures.push_back(std::make_shared<Rectangle<T>>(center, 4, 6));
+                break;
+            case 1:
+                figures.push_back(std::make_shared<Trapezoid<T>>(center, 6, 4, 2));
+                break;
+            default:
+                figures.push_back(std::make_shared<Rhombus<T>>(center, 6, 4));
+                break;
+        }
+    }
+    return figures;
+}
+
+template<Scalar T>
+static void BM_StreamOperator(benchmark::State& state) {
+    auto figures = make_mixed_figures<T>(static_cast<size_t>(state.range(0)));
+    size_t bytes = 0;
+    for (auto _ : state) {
+        std::ostringstream out;
+        for (size_t i = 0; i < figures.size(); ++i) {
+            out << *figures[i] << '\n';
+        }
+        bytes += static_cast<size_t>(out.tellp());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<Scalar T, FigureFormat Format>
+static void BM_Formatter(benchmark::State& state) {
+    auto figures = make_mixed_figures<T>(static_cast<size_t>(state.range(0)));
+    FigureFormatter<T> formatter(Format);
+    std::string out;
+    size_t bytes = 0;
+    for (auto _ : state) {
+        out.clear();
+        for (size_t i = 0; i < figures.size(); ++i) {
+            formatter.append(out, *figures[i]);
+            out += '\n';
+        }
+        bytes += out.size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<Scalar T>
+static void BM_OfstreamToDevNull(benchmark::State& state) {
+    auto figures = make_mixed_figures<T>(static_cast<size_t>(state.range(0)));
+    std::ofstream out("/dev/null");
+    for (auto _ : state) {
+        for (size_t i = 0; i < figures.size(); ++i) {
+            out << *figures[i] << '\n';
+        }
+        out.flush();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<Scalar T>
+static void BM_WriterToDevNull(benchmark::State& state) {
+    auto figures = make_mixed_figures<T>(static_cast<size_t>(state.range(0)));
+    int fd = ::open("/dev/null", O_WRONLY);
+    {
+        FigureWriter<T> writer(fd);
+        for (auto _ : state) {
+            for (size_t i = 0; i < figures.size(); ++i) {
+                writer.write(*figures[i]);
+            }
+            writer.flush();
+        }
+    }
+    ::close(fd);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define FIGURES_WRITER_BENCHMARKS(T)                                                                         \
+    BENCHMARK_TEMPLATE(BM_StreamOperator, T)->Arg(100000)->Unit(benchmark::kMillisecond);                   \
+    BENCHMARK_TEMPLATE(BM_Formatter, T, FigureFormat::Human)->Arg(100000)->Unit(benchmark::kMillisecond);   \
+    BENCHMARK_TEMPLATE(BM_Formatter, T, FigureFormat::Csv)->Arg(100000)->Unit(benchmark::kMillisecond);     \
+    BENCHMARK_TEMPLATE(BM_Formatter, T, FigureFormat::JsonLines)->Arg(100000)->Unit(benchmark::kMillisecond); \
+    BENCHMARK_TEMPLATE(BM_OfstreamToDevNull, T)->Arg(100000)->Unit(benchmark::kMillisecond);                \
+    BENCHMARK_TEMPLATE(BM_WriterToDevNull, T)->Arg(100000)->Unit(benchmark::kMillisecond)
+
+FIGURES_WRITER_BENCHMARKS(double);
+FIGURES_WRITER_BENCHMARKS(float);
+FIGURES_WRITER_BENCHMARKS(int);
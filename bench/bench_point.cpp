@@ -0,0 +1,25 @@
+#include <benchmark/benchmark.h>
+#include "Point.h"
+#include <vector>
+
+template<Scalar T>
+static void BM_PointDistance(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    std::vector<Point<T>> points;
+    points.reserve(count + 1);
+    for (size_t i = 0; i <= count; ++i) {
+        points.emplace_back(static_cast<T>(i % 1000), static_cast<T>(i % 777));
+    }
+    for (auto _ : state) {
+        double total = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            total += points[i].distance(points[i + 1]);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_PointDistance, int)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK_TEMPLATE(BM_PointDistance, float)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK_TEMPLATE(BM_PointDistance, double)->RangeMultiplier(10)->Range(10, 10000000);
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+#include "Polygon.h"
+#include "SimdKernels.h"
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+
+static std::vector<Point<double>> make_ring(size_t count, bool star) {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> jitter(0.9, 1.0);
+    std::vector<Point<double>> ring;
+    for (size_t i = 0; i < count; ++i) {
+        double angle = 2.0 * std::numbers::pi * static_cast<double>(i) / static_cast<double>(count);
+        double radius = 100.0 * (star && i % 2 == 1 ? 0.5 : jitter(rng));
+        ring.emplace_back(500.0 + radius * std::cos(angle), 500.0 + radius * std::sin(angle));
+    }
+    return ring;
+}
+
+static void BM_PolygonMomentsScalar(benchmark::State& state) {
+    auto ring = make_ring(static_cast<size_t>(state.range(0)), false);
+    for (auto _ : state) {
+        PolygonMoments moments = polygon_moments<double>(ring, SimdLevel::Scalar);
+        benchmark::DoNotOptimize(moments);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ring.size()));
+}
+
+static void BM_PolygonMomentsDetected(benchmark::State& state) {
+    auto ring = make_ring(static_cast<size_t>(state.range(0)), false);
+    for (auto _ : state) {
+        PolygonMoments moments = polygon_moments<double>(ring);
+        benchmark::DoNotOptimize(moments);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ring.size()));
+}
+
+static void BM_PolygonIsConvex(benchmark::State& state) {
+    Polygon<double> polygon(make_ring(static_cast<size_t>(state.range(0)), false));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(polygon.is_convex());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * polygon.vertex_count()));
+}
+
+static void BM_PolygonIsSimpleConcave(benchmark::State& state) {
+    Polygon<double> polygon(make_ring(static_cast<size_t>(state.range(0)), true));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(polygon.is_simple());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * polygon.vertex_count()));
+}
+
+BENCHMARK(BM_PolygonMomentsScalar)->Arg(8)->Arg(16)->Arg(64);
+BENCHMARK(BM_PolygonMomentsDetected)->Arg(8)->Arg(16)->Arg(64);
+BENCHMARK(BM_PolygonIsConvex)->Arg(8)->Arg(64);
+BENCHMARK(BM_PolygonIsSimpleConcave)->Arg(8)->Arg(64);
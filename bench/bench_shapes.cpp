@@ -0,0 +1,150 @@
+#include <benchmark/benchmark.h>
+#include "Array.h"
+#include "Rectangle.h"
+#include "Trapezoid.h"
+#include "Rhombus.h"
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <type_traits>
+#include <utility>
+
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override {
+        return traits_type::not_eof(c);
+    }
+    
+    std::streamsize xsputn(const char*, std::streamsize count) override {
+        return count;
+    }
+};
+
+template<Scalar T>
+static Array<std::shared_ptr<Figure<T>>> make_mixed_figures(size_t count) {
+    Array<std::shared_ptr<Figure<T>>> figures(count);
+    for (size_t i = 0; i < count; ++i) {
+        Point<T> center(static_cast<T>(i % 1000), static_cast<T>(i % 777));
+        switch (i % 3) {
+            case 0:
+                figures.push_back(std::make_shared<Rectangle<T>>(center, 4, 6));
+                break;
+            case 1:
+                figures.push_back(std::make_shared<Trapezoid<T>>(center, 6, 4, 2));
+                break;
+            default:
+                figures.push_back(std::make_shared<Rhombus<T>>(center, 6, 4));
+                break;
+        }
+    }
+    return figures;
+}
+
+template<Scalar T>
+static Rectangle<T> make_shape(std::type_identity<Rectangle<T>>) {
+    return Rectangle<T>(Point<T>(1, 2), 6, 4);
+}
+
+template<Scalar T>
+static Trapezoid<T> make_shape(std::type_identity<Trapezoid<T>>) {
+    return Trapezoid<T>(Point<T>(1, 2), 6, 4, 2);
+}
+
+template<Scalar T>
+static Rhombus<T> make_shape(std::type_identity<Rhombus<T>>) {
+    return Rhombus<T>(Point<T>(1, 2), 6, 4);
+}
+
+template<class Shape>
+static void BM_ConstructShape(benchmark::State& state) {
+    for (auto _ : state) {
+        Shape shape = make_shape(std::type_identity<Shape>{});
+        benchmark::DoNotOptimize(shape);
+    }
+}
+
+template<class Shape>
+static void BM_CopyShape(benchmark::State& state) {
+    Shape original = make_shape(std::type_identity<Shape>{});
+    for (auto _ : state) {
+        Shape copy(original);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+template<class Shape>
+static void BM_MoveShape(benchmark::State& state) {
+    Shape source = make_shape(std::type_identity<Shape>{});
+    for (auto _ : state) {
+        Shape moved(std::move(source));
+        benchmark::DoNotOptimize(moved);
+        source = std::move(moved);
+    }
+}
+
+template<Scalar T>
+static void BM_VirtualArea(benchmark::State& state) {
+    auto figures = make_mixed_figures<T>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        double total = 0.0;
+        for (size_t i = 0; i < figures.size(); ++i) {
+            total += figures[i]->area();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<Scalar T>
+static void BM_VirtualCenter(benchmark::State& state) {
+    auto figures = make_mixed_figures<T>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        T sum_x = T{};
+        T sum_y = T{};
+        for (size_t i = 0; i < figures.size(); ++i) {
+            Point<T> center = figures[i]->center();
+            sum_x += center.x();
+            sum_y += center.y();
+        }
+        benchmark::DoNotOptimize(sum_x);
+        benchmark::DoNotOptimize(sum_y);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<Scalar T>
+static void BM_FormatFigures(benchmark::State& state) {
+    auto figures = make_mixed_figures<T>(static_cast<size_t>(state.range(0)));
+    NullBuffer buffer;
+    std::ostream os(&buffer);
+    for (auto _ : state) {
+        for (size_t i = 0; i < figures.size(); ++i) {
+            os << *figures[i] << '\n';
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define FIGURES_SHAPE_BENCHMARKS(Shape)                     \
+    BENCHMARK_TEMPLATE(BM_ConstructShape, Shape<int>);      \
+    BENCHMARK_TEMPLATE(BM_ConstructShape, Shape<float>);    \
+    BENCHMARK_TEMPLATE(BM_ConstructShape, Shape<double>);   \
+    BENCHMARK_TEMPLATE(BM_CopyShape, Shape<int>);           \
+    BENCHMARK_TEMPLATE(BM_CopyShape, Shape<float>);         \
+    BENCHMARK_TEMPLATE(BM_CopyShape, Shape<double>);        \
+    BENCHMARK_TEMPLATE(BM_MoveShape, Shape<int>);           \
+    BENCHMARK_TEMPLATE(BM_MoveShape, Shape<float>);         \
+    BENCHMARK_TEMPLATE(BM_MoveShape, Shape<double>)
+
+FIGURES_SHAPE_BENCHMARKS(Rectangle);
+FIGURES_SHAPE_BENCHMARKS(Trapezoid);
+FIGURES_SHAPE_BENCHMARKS(Rhombus);
+
+#define FIGURES_COLLECTION_BENCHMARKS(T)                                                 \
+    BENCHMARK_TEMPLATE(BM_VirtualArea, T)->RangeMultiplier(10)->Range(10, 10000000);   \
+    BENCHMARK_TEMPLATE(BM_VirtualCenter, T)->RangeMultiplier(10)->Range(10, 10000000); \
+    BENCHMARK_TEMPLATE(BM_FormatFigures, T)->RangeMultiplier(10)->Range(10, 1000000)
+
+FIGURES_COLLECTION_BENCHMARKS(int);
+FIGURES_COLLECTION_BENCHMARKS(float);
+FIGURES_COLLECTION_BENCHMARKS(double);
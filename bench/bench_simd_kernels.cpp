@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include "FigureStore.h"
+#include "SimdKernels.h"
+#include <vector>
+
+template<Scalar T>
+static FigureStore<T> make_store(size_t count) {
+    FigureStore<T> store;
+    store.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        Point<T> center(static_cast<T>(i % 1000), static_cast<T>(i % 777));
+        switch (i % 3) {
+            case 0:
+                store.push_back(Rectangle<T>(center, 4, 6));
+                break;
+            case 1:
+                store.push_back(Trapezoid<T>(center, 6, 4, 2));
+                break;
+            default:
+                store.push_back(Rhombus<T>(center, 6, 4));
+                break;
+        }
+    }
+    return store;
+}
+
+template<Scalar T, SimdLevel Level>
+static void BM_BatchTotalArea(benchmark::State& state) {
+    if (Level > detected_simd_level()) {
+        state.SkipWithError("SIMD level not supported on this CPU");
+        return;
+    }
+    FigureStore<T> store = make_store<T>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(batch_total_area(store.columns(), Level));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<Scalar T, SimdLevel Level>
+static void BM_BatchCenters(benchmark::State& state) {
+    if (Level > detected_simd_level()) {
+        state.SkipWithError("SIMD level not supported on this CPU");
+        return;
+    }
+    FigureStore<T> store = make_store<T>(static_cast<size_t>(state.range(0)));
+    std::vector<T> center_x(store.size());
+    std::vector<T> center_y(store.size());
+    for (auto _ : state) {
+        batch_centers(store.columns(), center_x.data(), center_y.data(), Level);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define FIGURES_SIMD_BENCHMARKS(T)                                                                   \
+    BENCHMARK_TEMPLATE(BM_BatchTotalArea, T, SimdLevel::Scalar)->RangeMultiplier(100)->Range(1000, 10000000); \
+    BENCHMARK_TEMPLATE(BM_BatchTotalArea, T, SimdLevel::AVX2)->RangeMultiplier(100)->Range(1000, 10000000);   \
+    BENCHMARK_TEMPLATE(BM_BatchCenters, T, SimdLevel::Scalar)->RangeMultiplier(100)->Range(1000, 10000000);   \
+    BENCHMARK_TEMPLATE(BM_BatchCenters, T, SimdLevel::SSE2)->RangeMultiplier(100)->Range(1000, 10000000);     \
+    BENCHMARK_TEMPLATE(BM_BatchCenters, T, SimdLevel::AVX2)->RangeMultiplier(100)->Range(1000, 10000000)
+
+FIGURES_SIMD_BENCHMARKS(double);
+FIGURES_SIMD_BENCHMARKS(float);
+FIGURES_SIMD_BENCHMARKS(int);
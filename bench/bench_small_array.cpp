@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+#include "AllocationCounter.h"
+#include "Array.h"
+#include "SmallArray.h"
+#include "Rectangle.h"
+#include <memory>
+#include <vector>
+
+using FigurePtr = std::shared_ptr<Figure<double>>;
+
+template<class Container>
+static void BM_BuildRequestList(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    std::vector<FigurePtr> source;
+    for (size_t i = 0; i < count; ++i) {
+        double offset = static_cast<double>(i);
+        source.push_back(std::make_shared<Rectangle<double>>(Point<double>(offset, offset), 4.0, 3.0));
+    }
+    
+    size_t before = allocation_count();
+    for (auto _ : state) {
+        Container figures;
+        for (const auto& figure : source) {
+            figures.push_back(figure);
+        }
+        
+        double total = 0.0;
+        for (auto it = figures.begin(); it != figures.end(); ++it) {
+            total += (*it)->area();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.counters["allocs_per_op"] = benchmark::Counter(
+        static_cast<double>(allocation_count() - before) / static_cast<double>(state.iterations()));
+}
+
+BENCHMARK_TEMPLATE(BM_BuildRequestList, Array<FigurePtr>)->DenseRange(1, 16, 5)->Arg(32);
+BENCHMARK_TEMPLATE(BM_BuildRequestList, SmallArray<FigurePtr, 16>)->DenseRange(1, 16, 5)->Arg(32);
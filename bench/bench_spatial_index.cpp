@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+#include "Array.h"
+#include "BoundingBox.h"
+#include "RTree.h"
+#include "UniformGrid.h"
+#include "Rectangle.h"
+#include "Trapezoid.h"
+#include "Rhombus.h"
+#include <memory>
+#include <random>
+#include <vector>
+
+static constexpr double world_size = 10000.0;
+
+static Array<std::shared_ptr<Figure<double>>> make_scattered_figures(size_t count) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> coordinate(0.0, world_size);
+    std::uniform_real_distribution<double> size(0.5, 10.0);
+    
+    Array<std::shared_ptr<Figure<double>>> figures(count);
+    for (size_t i = 0; i < count; ++i) {
+        Point<double> center(coordinate(rng), coordinate(rng));
+        switch (i % 3) {
+            case 0:
+                figures.push_back(std::make_shared<Rectangle<double>>(center, size(rng), size(rng)));
+                break;
+            case 1:
+                figures.push_back(std::make_shared<Trapezoid<double>>(center, size(rng), size(rng), size(rng)));
+                break;
+            default:
+                figures.push_back(std::make_shared<Rhombus<double>>(center, size(rng), size(rng)));
+                break;
+        }
+    }
+    return figures;
+}
+
+static std::vector<BoundingBox<double>> make_windows(double extent) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> coordinate(0.0, world_size - extent);
+    std::vector<BoundingBox<double>> windows;
+    for (int i = 0; i < 64; ++i) {
+        double x = coordinate(rng);
+        double y = coordinate(rng);
+        windows.emplace_back(x, y, x + extent, y + extent);
+    }
+    return windows;
+}
+
+static void BM_WindowBruteForce(benchmark::State& state) {
+    auto figures = make_scattered_figures(static_cast<size_t>(state.range(0)));
+    auto windows = make_windows(static_cast<double>(state.range(1)));
+    std::vector<size_t> hits;
+    size_t next = 0;
+    for (auto _ : state) {
+        const BoundingBox<double>& window = windows[next++ % windows.size()];
+        hits.clear();
+        for (size_t i = 0; i < figures.size(); ++i) {
+            if (figures[i]->bounding_box().intersects(window)) {
+                hits.push_back(i);
+            }
+        }
+        benchmark::DoNotOptimize(hits.data());
+    }
+}
+
+template<class Index>
+static void BM_WindowQuery(benchmark::State& state) {
+    auto figures = make_scattered_figures(static_cast<size_t>(state.range(0)));
+    auto windows = make_windows(static_cast<double>(state.range(1)));
+    Index index(figures);
+    std::vector<size_t> hits;
+    size_t next = 0;
+    for (auto _ : state) {
+        hits.clear();
+        index.query(windows[next++ % windows.size()], hits);
+        benchmark::DoNotOptimize(hits.data());
+    }
+}
+
+template<class Index>
+static void BM_PointStab(benchmark::State& state) {
+    auto figures = make_scattered_figures(static_cast<size_t>(state.range(0)));
+    Index index(figures);
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> coordinate(0.0, world_size);
+    std::vector<size_t> hits;
+    for (auto _ : state) {
+        hits.clear();
+        index.stab(Point<double>(coordinate(rng), coordinate(rng)), hits);
+        benchmark::DoNotOptimize(hits.data());
+    }
+}
+
+template<class Index>
+static void BM_BuildIndex(benchmark::State& state) {
+    auto figures = make_scattered_figures(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        Index index(figures);
+        benchmark::DoNotOptimize(index.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_RTreeIncrementalInsert(benchmark::State& state) {
+    auto figures = make_scattered_figures(static_cast<size_t>(state.range(0)));
+    std::vector<BoundingBox<double>> boxes;
+    boxes.reserve(figures.size());
+    for (size_t i = 0; i < figures.size(); ++i) {
+        boxes.push_back(figures[i]->bounding_box());
+    }
+    for (auto _ : state) {
+        RTree<double> tree;
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            tree.insert(i, boxes[i]);
+        }
+        benchmark::DoNotOptimize(tree.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_WindowBruteForce)->ArgsProduct({{1000000}, {10, 100, 1000}});
+BENCHMARK_TEMPLATE(BM_WindowQuery, RTree<double>)->ArgsProduct({{1000000}, {10, 100, 1000}});
+BENCHMARK_TEMPLATE(BM_WindowQuery, UniformGrid<double>)->ArgsProduct({{1000000}, {10, 100, 1000}});
+BENCHMARK_TEMPLATE(BM_PointStab, RTree<double>)->Arg(1000000);
+BENCHMARK_TEMPLATE(BM_PointStab, UniformGrid<double>)->Arg(1000000);
+BENCHMARK_TEMPLATE(BM_BuildIndex, RTree<double>)->Arg(1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_BuildIndex, UniformGrid<double>)->Arg(1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RTreeIncrementalInsert)->Arg(1000000)->Unit(benchmark::kMillisecond);
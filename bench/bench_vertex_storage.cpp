@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include "AllocationCounter.h"
+#include "Point.h"
+#include "Rectangle.h"
+#include <memory>
+#include <vector>
+
+template<Scalar T>
+class HeapRectangle {
+private:
+    std::vector<std::unique_ptr<Point<T>>> vertices_;
+
+public:
+    HeapRectangle(const Point<T>& center, T width, T height) {
+        T half_width = width / 2;
+        T half_height = height / 2;
+        
+        vertices_.push_back(std::make_unique<Point<T>>(center.x() - half_width, center.y() - half_height));
+        vertices_.push_back(std::make_unique<Point<T>>(center.x() + half_width, center.y() - half_height));
+        vertices_.push_back(std::make_unique<Point<T>>(center.x() + half_width, center.y() + half_height));
+        vertices_.push_back(std::make_unique<Point<T>>(center.x() - half_width, center.y() + half_height));
+    }
+    
+    HeapRectangle(const HeapRectangle& other) {
+        vertices_.reserve(other.vertices_.size());
+        for (const auto& vertex : other.vertices_) {
+            vertices_.push_back(std::make_unique<Point<T>>(*vertex));
+        }
+    }
+    
+    double area() const {
+        return vertices_[0]->distance(*vertices_[1]) * vertices_[1]->distance(*vertices_[2]);
+    }
+};
+
+static void report_allocations(benchmark::State& state, size_t before) {
+    state.counters["allocs_per_op"] = benchmark::Counter(
+        static_cast<double>(allocation_count() - before) / static_cast<double>(state.iterations()));
+}
+
+template<class Shape>
+static void BM_Construct(benchmark::State& state) {
+    size_t before = allocation_count();
+    for (auto _ : state) {
+        Shape shape(Point<double>(1.0, 2.0), 4.0, 3.0);
+        benchmark::DoNotOptimize(shape);
+    }
+    report_allocations(state, before);
+}
+
+template<class Shape>
+static void BM_Copy(benchmark::State& state) {
+    Shape original(Point<double>(1.0, 2.0), 4.0, 3.0);
+    size_t before = allocation_count();
+    for (auto _ : state) {
+        Shape copy(original);
+        benchmark::DoNotOptimize(copy);
+    }
+    report_allocations(state, before);
+}
+
+template<class Shape>
+static void BM_Area(benchmark::State& state) {
+    std::vector<Shape> shapes;
+    shapes.reserve(1024);
+    for (int i = 0; i < 1024; ++i) {
+        shapes.emplace_back(Point<double>(i, -i), 4.0 + i % 7, 3.0 + i % 5);
+    }
+    
+    size_t before = allocation_count();
+    for (auto _ : state) {
+        double total = 0.0;
+        for (const auto& shape : shapes) {
+            total += shape.area();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    report_allocations(state, before);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(shapes.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_Construct, HeapRectangle<double>);
+BENCHMARK_TEMPLATE(BM_Construct, Rectangle<double>);
+BENCHMARK_TEMPLATE(BM_Copy, HeapRectangle<double>);
+BENCHMARK_TEMPLATE(BM_Copy, Rectangle<double>);
+BENCHMARK_TEMPLATE(BM_Area, HeapRectangle<double>);
+BENCHMARK_TEMPLATE(BM_Area, Rectangle<double>);
@@ -0,0 +1,140 @@
+#pragma once
+#include "Point.h"
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+class AffineTransform {
+private:
+    double a_ = 1.0;
+    double b_ = 0.0;
+    double c_ = 0.0;
+    double d_ = 1.0;
+    double tx_ = 0.0;
+    double ty_ = 0.0;
+
+public:
+    constexpr AffineTransform() = default;
+    
+    constexpr AffineTransform(double a, double b, double c, double d, double tx, double ty)
+        : a_(a), b_(b), c_(c), d_(d), tx_(tx), ty_(ty) {}
+    
+    constexpr AffineTransform(const AffineTransform& other) = default;
+    
+    constexpr AffineTransform(AffineTransform&& other) noexcept = default;
+    
+    constexpr AffineTransform& operator=(const AffineTransform& other) = default;
+    
+    constexpr AffineTransform& operator=(AffineTransform&& other) noexcept = default;
+    
+    static constexpr AffineTransform identity() {
+        return AffineTransform();
+    }
+    
+    static constexpr AffineTransform translation(double dx, double dy) {
+        return AffineTransform(1.0, 0.0, 0.0, 1.0, dx, dy);
+    }
+    
+    static constexpr AffineTransform scaling(double sx, double sy) {
+        return AffineTransform(sx, 0.0, 0.0, sy, 0.0, 0.0);
+    }
+    
+    static constexpr AffineTransform scaling(double factor) {
+        return scaling(factor, factor);
+    }
+    
+    static AffineTransform rotation(double radians) {
+        double cosine = std::cos(radians);
+        double sine = std::sin(radians);
+        return AffineTransform(cosine, -sine, sine, cosine, 0.0, 0.0);
+    }
+    
+    constexpr double a() const { return a_; }
+    constexpr double b() const { return b_; }
+    constexpr double c() const { return c_; }
+    constexpr double d() const { return d_; }
+    constexpr double tx() const { return tx_; }
+    constexpr double ty() const { return ty_; }
+    
+    constexpr AffineTransform then(const AffineTransform& next) const {
+        return AffineTransform(next.a_ * a_ + next.b_ * c_, next.a_ * b_ + next.b_ * d_,
+                               next.c_ * a_ + next.d_ * c_, next.c_ * b_ + next.d_ * d_,
+                               next.a_ * tx_ + next.b_ * ty_ + next.tx_, next.c_ * tx_ + next.d_ * ty_ + next.ty_);
+    }
+    
+    template<Scalar T>
+    constexpr AffineTransform about(const Point<T>& pivot) const {
+        double x = static_cast<double>(pivot.x());
+        double y = static_cast<double>(pivot.y());
+        return translation(-x, -y).then(*this).then(translation(x, y));
+    }
+    
+    constexpr double determinant() const {
+        return a_ * d_ - b_ * c_;
+    }
+    
+    constexpr bool is_identity() const {
+        return is_translation() && tx_ == 0.0 && ty_ == 0.0;
+    }
+    
+    constexpr bool is_translation() const {
+        return a_ == 1.0 && b_ == 0.0 && c_ == 0.0 && d_ == 1.0;
+    }
+    
+    constexpr bool is_axis_aligned() const {
+        return b_ == 0.0 && c_ == 0.0;
+    }
+    
+    template<Scalar T>
+    static constexpr bool representable(double value) {
+        if constexpr (IntegralScalar<T>) {
+            double rounded = value < 0.0 ? value - 0.5 : value + 0.5;
+            return std::isfinite(value) && rounded > static_cast<double>(std::numeric_limits<T>::min()) - 1.0 &&
+                   rounded < static_cast<double>(std::numeric_limits<T>::max()) + 1.0;
+        } else {
+            return true;
+        }
+    }
+    
+    template<Scalar T>
+    static constexpr T convert(double value) {
+        if constexpr (IntegralScalar<T>) {
+            if (!representable<T>(value)) {
+                if (std::isnan(value)) {
+                    return T{};
+                }
+                return value < 0.0 ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+            }
+            return static_cast<T>(value < 0.0 ? value - 0.5 : value + 0.5);
+        } else {
+            return static_cast<T>(value);
+        }
+    }
+    
+    template<Scalar T>
+    constexpr Point<T> apply(const Point<T>& point) const {
+        double x = static_cast<double>(point.x());
+        double y = static_cast<double>(point.y());
+        return Point<T>(convert<T>(a_ * x + b_ * y + tx_), convert<T>(c_ * x + d_ * y + ty_));
+    }
+    
+    template<Scalar T>
+    constexpr bool fits(const Point<T>& point) const {
+        double x = static_cast<double>(point.x());
+        double y = static_cast<double>(point.y());
+        return representable<T>(a_ * x + b_ * y + tx_) && representable<T>(c_ * x + d_ * y + ty_);
+    }
+    
+    constexpr Point<double> operator()(const Point<double>& point) const {
+        return apply(point);
+    }
+    
+    constexpr bool operator==(const AffineTransform& other) const {
+        return a_ == other.a_ && b_ == other.b_ && c_ == other.c_ && d_ == other.d_ && tx_ == other.tx_ &&
+               ty_ == other.ty_;
+    }
+    
+    constexpr bool operator!=(const AffineTransform& other) const {
+        return !(*this == other);
+    }
+};
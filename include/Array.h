@@ -1,87 +1,251 @@
 #pragma once
+#include "ArrayPolicies.h"
+#include <compare>
+#include <cstddef>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include <span>
 #include <stdexcept>
 #include <iostream>
 
-template<class T>
+template<class T,
+         class BoundsPolicy = CheckedBounds,
+         class GrowthPolicy = GeometricGrowth<>,
+         class Allocator = std::allocator<T>>
 class Array {
 private:
-    std::shared_ptr<T[]> data_;
+    using alloc_traits = std::allocator_traits<Allocator>;
+    
+    T* data_;
     size_t size_;
     size_t capacity_;
-
-    void resize_if_needed() {
-        if (size_ >= capacity_) {
-            size_t new_capacity = capacity_ == 0 ? 1 : capacity_ * 2;
-            auto new_data = std::shared_ptr<T[]>(new T[new_capacity]);
-            
-            for (size_t i = 0; i < size_; ++i) {
-                new_data[i] = std::move(data_[i]);
+    [[no_unique_address]] Allocator allocator_;
+    
+    T* allocate(size_t count) {
+        return count == 0 ? nullptr : alloc_traits::allocate(allocator_, count);
+    }
+    
+    void deallocate(T* data, size_t count) {
+        if (data != nullptr) {
+            alloc_traits::deallocate(allocator_, data, count);
+        }
+    }
+    
+    void destroy(T* data, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            alloc_traits::destroy(allocator_, data + i);
+        }
+    }
+    
+    template<class Source>
+    void construct_from(Source&& source, size_t count, T* to) {
+        size_t constructed = 0;
+        try {
+            for (; constructed < count; ++constructed) {
+                alloc_traits::construct(allocator_, to + constructed, source(constructed));
             }
-            
-            data_ = new_data;
-            capacity_ = new_capacity;
+        } catch (...) {
+            destroy(to, constructed);
+            throw;
         }
     }
+    
+    void copy_into(const T* from, size_t count, T* to) {
+        construct_from([from](size_t i) -> const T& { return from[i]; }, count, to);
+    }
+    
+    void relocate(T* from, size_t count, T* to) {
+        construct_from([from](size_t i) -> decltype(auto) { return std::move_if_noexcept(from[i]); }, count, to);
+    }
+    
+    void release() {
+        destroy(data_, size_);
+        deallocate(data_, capacity_);
+        data_ = nullptr;
+        size_ = 0;
+        capacity_ = 0;
+    }
+    
+    void steal(Array& other) noexcept {
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+    }
+    
+    void reallocate(size_t new_capacity) {
+        T* new_data = allocate(new_capacity);
+        try {
+            relocate(data_, size_, new_data);
+        } catch (...) {
+            deallocate(new_data, new_capacity);
+            throw;
+        }
+        
+        destroy(data_, size_);
+        deallocate(data_, capacity_);
+        data_ = new_data;
+        capacity_ = new_capacity;
+    }
 
 public:
-    Array() : data_(nullptr), size_(0), capacity_(0) {}
+    using value_type = T;
+    using allocator_type = Allocator;
     
-    explicit Array(size_t initial_capacity) 
-        : data_(std::shared_ptr<T[]>(new T[initial_capacity])), 
+    Array() : data_(nullptr), size_(0), capacity_(0), allocator_() {}
+    
+    explicit Array(const Allocator& allocator) 
+        : data_(nullptr), size_(0), capacity_(0), allocator_(allocator) {}
+    
+    explicit Array(size_t initial_capacity, const Allocator& allocator = Allocator()) 
+        : data_(nullptr), 
           size_(0), 
-          capacity_(initial_capacity) {}
+          capacity_(0), 
+          allocator_(allocator) {
+        data_ = allocate(initial_capacity);
+        capacity_ = initial_capacity;
+    }
     
-    Array(const Array& other) 
-        : data_(std::shared_ptr<T[]>(new T[other.capacity_])), 
-          size_(other.size_), 
-          capacity_(other.capacity_) {
-        for (size_t i = 0; i < size_; ++i) {
-            data_[i] = other.data_[i];
+    Array(const Array& other, const Allocator& allocator) 
+        : data_(nullptr), 
+          size_(0), 
+          capacity_(0), 
+          allocator_(allocator) {
+        data_ = allocate(other.capacity_);
+        capacity_ = other.capacity_;
+        try {
+            copy_into(other.data_, other.size_, data_);
+        } catch (...) {
+            deallocate(data_, capacity_);
+            throw;
         }
+        size_ = other.size_;
     }
     
+    Array(const Array& other) 
+        : Array(other, alloc_traits::select_on_container_copy_construction(other.allocator_)) {}
+    
     Array(Array&& other) noexcept 
-        : data_(std::move(other.data_)), 
-          size_(other.size_), 
-          capacity_(other.capacity_) {
-        other.size_ = 0;
-        other.capacity_ = 0;
+        : data_(nullptr), 
+          size_(0), 
+          capacity_(0), 
+          allocator_(std::move(other.allocator_)) {
+        steal(other);
+    }
+    
+    ~Array() {
+        release();
     }
     
     Array& operator=(const Array& other) {
         if (this != &other) {
-            data_ = std::shared_ptr<T[]>(new T[other.capacity_]);
-            size_ = other.size_;
-            capacity_ = other.capacity_;
-            
-            for (size_t i = 0; i < size_; ++i) {
-                data_[i] = other.data_[i];
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                if (allocator_ != other.allocator_) {
+                    release();
+                }
+                allocator_ = other.allocator_;
             }
+            Array copy(other, allocator_);
+            release();
+            steal(copy);
         }
         return *this;
     }
     
-    Array& operator=(Array&& other) noexcept {
+    Array& operator=(Array&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value || 
+                                             alloc_traits::is_always_equal::value) {
         if (this != &other) {
-            data_ = std::move(other.data_);
-            size_ = other.size_;
-            capacity_ = other.capacity_;
-            
-            other.size_ = 0;
-            other.capacity_ = 0;
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                release();
+                allocator_ = std::move(other.allocator_);
+                steal(other);
+            } else if (allocator_ == other.allocator_) {
+                release();
+                steal(other);
+            } else {
+                Array moved(allocator_);
+                moved.reserve(other.size_);
+                moved.relocate(other.data_, other.size_, moved.data_);
+                moved.size_ = other.size_;
+                other.clear();
+                release();
+                steal(moved);
+            }
         }
         return *this;
     }
     
+    void swap(Array& other) noexcept {
+        if constexpr (alloc_traits::propagate_on_container_swap::value) {
+            std::swap(allocator_, other.allocator_);
+        }
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+    
+    allocator_type get_allocator() const {
+        return allocator_;
+    }
+    
+    template<class... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ < capacity_) {
+            alloc_traits::construct(allocator_, data_ + size_, std::forward<Args>(args)...);
+            return data_[size_++];
+        }
+        
+        size_t new_capacity = GrowthPolicy::next(capacity_);
+        T* new_data = allocate(new_capacity);
+        try {
+            alloc_traits::construct(allocator_, new_data + size_, std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(new_data, new_capacity);
+            throw;
+        }
+        
+        try {
+            relocate(data_, size_, new_data);
+        } catch (...) {
+            alloc_traits::destroy(allocator_, new_data + size_);
+            deallocate(new_data, new_capacity);
+            throw;
+        }
+        
+        destroy(data_, size_);
+        deallocate(data_, capacity_);
+        data_ = new_data;
+        capacity_ = new_capacity;
+        return data_[size_++];
+    }
+    
     void push_back(const T& item) {
-        resize_if_needed();
-        data_[size_++] = item;
+        emplace_back(item);
     }
     
     void push_back(T&& item) {
-        resize_if_needed();
-        data_[size_++] = std::move(item);
+        emplace_back(std::move(item));
+    }
+    
+    void pop_back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Array is empty");
+        }
+        alloc_traits::destroy(allocator_, data_ + --size_);
+    }
+    
+    void reserve(size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            reallocate(new_capacity);
+        }
+    }
+    
+    void shrink_to_fit() {
+        if (capacity_ > size_) {
+            reallocate(size_);
+        }
     }
     
     void remove(size_t index) {
@@ -93,23 +257,84 @@ public:
             data_[i] = std::move(data_[i + 1]);
         }
         
-        --size_;
+        alloc_traits::destroy(allocator_, data_ + --size_);
     }
     
-    T& operator[](size_t index) {
+    void swap_remove(size_t index) {
         if (index >= size_) {
             throw std::out_of_range("Index out of range");
         }
+        
+        if (index != size_ - 1) {
+            data_[index] = std::move(data_[size_ - 1]);
+        }
+        
+        alloc_traits::destroy(allocator_, data_ + --size_);
+    }
+    
+    template<class Predicate>
+    size_t erase_if(Predicate predicate) {
+        size_t kept = 0;
+        for (size_t i = 0; i < size_; ++i) {
+            if (!predicate(std::as_const(data_[i]))) {
+                if (kept != i) {
+                    data_[kept] = std::move(data_[i]);
+                }
+                ++kept;
+            }
+        }
+        
+        size_t removed = size_ - kept;
+        destroy(data_ + kept, removed);
+        size_ = kept;
+        return removed;
+    }
+    
+    void remove_indices(std::span<const size_t> indices) {
+        for (size_t i = 0; i < indices.size(); ++i) {
+            if (indices[i] >= size_) {
+                throw std::out_of_range("Index out of range");
+            }
+            if (i > 0 && indices[i] <= indices[i - 1]) {
+                throw std::invalid_argument("Indices must be strictly increasing");
+            }
+        }
+        
+        size_t kept = 0;
+        size_t next = 0;
+        for (size_t i = 0; i < size_; ++i) {
+            if (next < indices.size() && indices[next] == i) {
+                ++next;
+                continue;
+            }
+            if (kept != i) {
+                data_[kept] = std::move(data_[i]);
+            }
+            ++kept;
+        }
+        
+        destroy(data_ + kept, size_ - kept);
+        size_ = kept;
+    }
+    
+    T& operator[](size_t index) {
+        BoundsPolicy::check(index, size_);
         return data_[index];
     }
     
     const T& operator[](size_t index) const {
-        if (index >= size_) {
-            throw std::out_of_range("Index out of range");
-        }
+        BoundsPolicy::check(index, size_);
         return data_[index];
     }
     
+    T* data() {
+        return data_;
+    }
+    
+    const T* data() const {
+        return data_;
+    }
+    
     size_t size() const {
         return size_;
     }
@@ -123,6 +348,7 @@ public:
     }
     
     void clear() {
+        destroy(data_, size_);
         size_ = 0;
     }
     
@@ -140,45 +366,113 @@ public:
         return data_[index];
     }
     
-    class iterator {
+    template<class Value>
+    class basic_iterator {
     private:
-        T* ptr_;
+        Value* ptr_ = nullptr;
         
     public:
-        explicit iterator(T* ptr) : ptr_(ptr) {}
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::contiguous_iterator_tag;
+        using value_type = std::remove_const_t<Value>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+        
+        basic_iterator() = default;
+        
+        explicit basic_iterator(Value* ptr) : ptr_(ptr) {}
         
-        T& operator*() { return *ptr_; }
-        const T& operator*() const { return *ptr_; }
+        template<class Other>
+            requires std::is_convertible_v<Other*, Value*>
+        basic_iterator(const basic_iterator<Other>& other) : ptr_(other.operator->()) {}
         
-        T* operator->() { return ptr_; }
-        const T* operator->() const { return ptr_; }
+        Value& operator*() const { return *ptr_; }
+        Value* operator->() const { return ptr_; }
+        Value& operator[](difference_type offset) const { return ptr_[offset]; }
         
-        iterator& operator++() {
+        basic_iterator& operator++() {
             ++ptr_;
             return *this;
         }
         
-        iterator operator++(int) {
-            iterator temp = *this;
+        basic_iterator operator++(int) {
+            basic_iterator temp = *this;
             ++ptr_;
             return temp;
         }
         
-        bool operator==(const iterator& other) const {
+        basic_iterator& operator--() {
+            --ptr_;
+            return *this;
+        }
+        
+        basic_iterator operator--(int) {
+            basic_iterator temp = *this;
+            --ptr_;
+            return temp;
+        }
+        
+        basic_iterator& operator+=(difference_type offset) {
+            ptr_ += offset;
+            return *this;
+        }
+        
+        basic_iterator& operator-=(difference_type offset) {
+            ptr_ -= offset;
+            return *this;
+        }
+        
+        friend basic_iterator operator+(basic_iterator it, difference_type offset) {
+            return it += offset;
+        }
+        
+        friend basic_iterator operator+(difference_type offset, basic_iterator it) {
+            return it += offset;
+        }
+        
+        friend basic_iterator operator-(basic_iterator it, difference_type offset) {
+            return it -= offset;
+        }
+        
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) {
+            return a.ptr_ - b.ptr_;
+        }
+        
+        bool operator==(const basic_iterator& other) const {
             return ptr_ == other.ptr_;
         }
         
-        bool operator!=(const iterator& other) const {
-            return ptr_ != other.ptr_;
+        std::strong_ordering operator<=>(const basic_iterator& other) const {
+            return ptr_ <=> other.ptr_;
         }
     };
     
+    using iterator = basic_iterator<T>;
+    using const_iterator = basic_iterator<const T>;
+    
     iterator begin() {
-        return iterator(data_.get());
+        return iterator(data_);
     }
     
     iterator end() {
-        return iterator(data_.get() + size_);
+        return iterator(data_ + size_);
+    }
+    
+    const_iterator begin() const {
+        return const_iterator(data_);
+    }
+    
+    const_iterator end() const {
+        return const_iterator(data_ + size_);
+    }
+    
+    const_iterator cbegin() const {
+        return begin();
+    }
+    
+    const_iterator cend() const {
+        return end();
     }
     
     friend std::ostream& operator<<(std::ostream& os, const Array& arr) {
@@ -193,3 +487,6 @@ public:
         return os;
     }
 };
+
+template<class T, class BoundsPolicy = CheckedBounds, class GrowthPolicy = GeometricGrowth<>>
+using PmrArray = Array<T, BoundsPolicy, GrowthPolicy, std::pmr::polymorphic_allocator<T>>;
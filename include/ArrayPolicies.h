@@ -0,0 +1,45 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+
+struct CheckedBounds {
+    static void check(size_t index, size_t size) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+};
+
+struct AssertBounds {
+    static void check([[maybe_unused]] size_t index, [[maybe_unused]] size_t size) {
+        assert(index < size && "Index out of range");
+    }
+};
+
+struct UncheckedBounds {
+    static void check(size_t, size_t) {}
+};
+
+template<size_t Numerator = 2, size_t Denominator = 1, size_t Initial = 1>
+struct GeometricGrowth {
+    static_assert(Numerator > Denominator && Denominator > 0, "Growth factor must be greater than one");
+    static_assert(Initial > 0, "Initial capacity must be positive");
+    
+    static size_t next(size_t capacity) {
+        if (capacity == 0) {
+            return Initial;
+        }
+        size_t grown = capacity / Denominator * Numerator + capacity % Denominator * Numerator / Denominator;
+        return grown > capacity ? grown : capacity + 1;
+    }
+};
+
+template<size_t Chunk>
+struct ChunkGrowth {
+    static_assert(Chunk > 0, "Chunk size must be positive");
+    
+    static size_t next(size_t capacity) {
+        return capacity + Chunk;
+    }
+};
@@ -0,0 +1,110 @@
+#pragma once
+#include "Point.h"
+#include <algorithm>
+#include <stdexcept>
+#include <iostream>
+
+template<Scalar T>
+class BoundingBox {
+private:
+    T min_x_, min_y_, max_x_, max_y_;
+
+public:
+    constexpr BoundingBox() : min_x_(T{}), min_y_(T{}), max_x_(T{}), max_y_(T{}) {}
+    
+    constexpr BoundingBox(T min_x, T min_y, T max_x, T max_y) 
+        : min_x_(min_x), min_y_(min_y), max_x_(max_x), max_y_(max_y) {
+        if (min_x > max_x || min_y > max_y) {
+            throw std::invalid_argument("Invalid bounding box");
+        }
+    }
+    
+    explicit constexpr BoundingBox(const Point<T>& point) 
+        : min_x_(point.x()), min_y_(point.y()), max_x_(point.x()), max_y_(point.y()) {}
+    
+    constexpr BoundingBox(const Point<T>& min, const Point<T>& max) 
+        : BoundingBox(min.x(), min.y(), max.x(), max.y()) {}
+    
+    constexpr BoundingBox(const BoundingBox& other) = default;
+    
+    constexpr BoundingBox(BoundingBox&& other) noexcept = default;
+    
+    constexpr BoundingBox& operator=(const BoundingBox& other) = default;
+    
+    constexpr BoundingBox& operator=(BoundingBox&& other) noexcept = default;
+    
+    constexpr T min_x() const { return min_x_; }
+    constexpr T min_y() const { return min_y_; }
+    constexpr T max_x() const { return max_x_; }
+    constexpr T max_y() const { return max_y_; }
+    
+    constexpr Point<T> min() const { return Point<T>(min_x_, min_y_); }
+    constexpr Point<T> max() const { return Point<T>(max_x_, max_y_); }
+    
+    constexpr T width() const { return max_x_ - min_x_; }
+    constexpr T height() const { return max_y_ - min_y_; }
+    
+    constexpr double area() const {
+        return static_cast<double>(width()) * static_cast<double>(height());
+    }
+    
+    constexpr double center_x() const {
+        return (static_cast<double>(min_x_) + static_cast<double>(max_x_)) / 2.0;
+    }
+    
+    constexpr double center_y() const {
+        return (static_cast<double>(min_y_) + static_cast<double>(max_y_)) / 2.0;
+    }
+    
+    constexpr bool contains(const Point<T>& point) const {
+        return point.x() >= min_x_ && point.x() <= max_x_ && 
+               point.y() >= min_y_ && point.y() <= max_y_;
+    }
+    
+    constexpr bool contains(const BoundingBox& other) const {
+        return other.min_x_ >= min_x_ && other.max_x_ <= max_x_ && 
+               other.min_y_ >= min_y_ && other.max_y_ <= max_y_;
+    }
+    
+    constexpr bool intersects(const BoundingBox& other) const {
+        return other.min_x_ <= max_x_ && other.max_x_ >= min_x_ && 
+               other.min_y_ <= max_y_ && other.max_y_ >= min_y_;
+    }
+    
+    constexpr void expand(const Point<T>& point) {
+        min_x_ = std::min(min_x_, point.x());
+        min_y_ = std::min(min_y_, point.y());
+        max_x_ = std::max(max_x_, point.x());
+        max_y_ = std::max(max_y_, point.y());
+    }
+    
+    constexpr void expand(const BoundingBox& other) {
+        min_x_ = std::min(min_x_, other.min_x_);
+        min_y_ = std::min(min_y_, other.min_y_);
+        max_x_ = std::max(max_x_, other.max_x_);
+        max_y_ = std::max(max_y_, other.max_y_);
+    }
+    
+    constexpr BoundingBox united(const BoundingBox& other) const {
+        BoundingBox result = *this;
+        result.expand(other);
+        return result;
+    }
+    
+    constexpr double enlargement(const BoundingBox& other) const {
+        return united(other).area() - area();
+    }
+    
+    constexpr bool operator==(const BoundingBox& other) const {
+        return min() == other.min() && max() == other.max();
+    }
+    
+    constexpr bool operator!=(const BoundingBox& other) const {
+        return !(*this == other);
+    }
+    
+    friend std::ostream& operator<<(std::ostream& os, const BoundingBox& box) {
+        os << "[" << box.min() << ", " << box.max() << "]";
+        return os;
+    }
+};
@@ -0,0 +1,222 @@
+#pragma once
+#include "Array.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+template<class T, size_t FirstSegment = 64>
+class ConcurrentArray {
+    static_assert(std::has_single_bit(FirstSegment), "First segment size must be a power of two");
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned elements are not supported");
+
+public:
+    static constexpr size_t first_segment = FirstSegment;
+    static constexpr size_t max_segments = 64 - std::countr_zero(FirstSegment);
+
+private:
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+        bool ready_flag;
+        
+        bool ready(std::memory_order order) const {
+            return std::atomic_ref<bool>(const_cast<bool&>(ready_flag)).load(order);
+        }
+        
+        void publish() {
+            std::atomic_ref<bool>(ready_flag).store(true, std::memory_order_release);
+        }
+        
+        T* get() {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+        
+        const T* get() const {
+            return std::launder(reinterpret_cast<const T*>(storage));
+        }
+    };
+    
+    std::array<std::atomic<Slot*>, max_segments> segments_{};
+    alignas(64) std::atomic<size_t> reserved_{0};
+    alignas(64) std::atomic<size_t> published_{0};
+    
+    static constexpr size_t segment_size(size_t segment) {
+        return FirstSegment << segment;
+    }
+    
+    static constexpr std::pair<size_t, size_t> locate(size_t index) {
+        size_t biased = index + FirstSegment;
+        size_t segment = static_cast<size_t>(std::bit_width(biased)) - 1 - std::countr_zero(FirstSegment);
+        return {segment, biased - segment_size(segment)};
+    }
+    
+    Slot* ensure_segment(size_t segment) {
+        Slot* slots = segments_[segment].load(std::memory_order_acquire);
+        if (slots != nullptr) {
+            return slots;
+        }
+        
+        Slot* fresh = static_cast<Slot*>(std::calloc(segment_size(segment), sizeof(Slot)));
+        if (fresh == nullptr) {
+            throw std::bad_alloc();
+        }
+        if (segments_[segment].compare_exchange_strong(slots, fresh, std::memory_order_acq_rel,
+                                                       std::memory_order_acquire)) {
+            return fresh;
+        }
+        std::free(fresh);
+        return slots;
+    }
+    
+    const Slot* find_slot(size_t index) const {
+        if (index >= reserved_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        auto [segment, offset] = locate(index);
+        const Slot* slots = segments_[segment].load(std::memory_order_acquire);
+        if (slots == nullptr || !slots[offset].ready(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return &slots[offset];
+    }
+    
+    template<class Visitor>
+    void visit_slots(Visitor&& visitor) const {
+        size_t reserved = reserved_.load(std::memory_order_acquire);
+        for (size_t segment = 0, begin = 0; segment < max_segments && begin < reserved;
+             begin += segment_size(segment), ++segment) {
+            Slot* slots = segments_[segment].load(std::memory_order_acquire);
+            if (slots == nullptr) {
+                continue;
+            }
+            size_t count = std::min(segment_size(segment), reserved - begin);
+            for (size_t offset = 0; offset < count; ++offset) {
+                if (slots[offset].ready(std::memory_order_acquire)) {
+                    visitor(begin + offset, slots[offset]);
+                }
+            }
+        }
+    }
+
+public:
+    using value_type = T;
+    
+    ConcurrentArray() = default;
+    
+    explicit ConcurrentArray(size_t initial_capacity) {
+        reserve(initial_capacity);
+    }
+    
+    ConcurrentArray(const ConcurrentArray& other) = delete;
+    
+    ConcurrentArray(ConcurrentArray&& other) = delete;
+    
+    ConcurrentArray& operator=(const ConcurrentArray& other) = delete;
+    
+    ConcurrentArray& operator=(ConcurrentArray&& other) = delete;
+    
+    ~ConcurrentArray() {
+        clear();
+    }
+    
+    void reserve(size_t new_capacity) {
+        for (size_t segment = 0, begin = 0; segment < max_segments && begin < new_capacity;
+             begin += segment_size(segment), ++segment) {
+            ensure_segment(segment);
+        }
+    }
+    
+    template<class... Args>
+    size_t emplace_back(Args&&... args) {
+        size_t index = reserved_.fetch_add(1, std::memory_order_relaxed);
+        auto [segment, offset] = locate(index);
+        Slot& slot = ensure_segment(segment)[offset];
+        ::new (static_cast<void*>(slot.storage)) T(std::forward<Args>(args)...);
+        slot.publish();
+        published_.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+    
+    size_t push_back(const T& item) {
+        return emplace_back(item);
+    }
+    
+    size_t push_back(T&& item) {
+        return emplace_back(std::move(item));
+    }
+    
+    bool published(size_t index) const {
+        return find_slot(index) != nullptr;
+    }
+    
+    const T& operator[](size_t index) const {
+        return at(index);
+    }
+    
+    const T& at(size_t index) const {
+        const Slot* slot = find_slot(index);
+        if (slot == nullptr) {
+            throw std::out_of_range("Index out of range");
+        }
+        return *slot->get();
+    }
+    
+    template<class Visitor>
+    void for_each(Visitor&& visitor) const {
+        visit_slots([&visitor](size_t, Slot& slot) { visitor(*slot.get()); });
+    }
+    
+    size_t size() const {
+        return published_.load(std::memory_order_acquire);
+    }
+    
+    bool empty() const {
+        return size() == 0;
+    }
+    
+    size_t capacity() const {
+        size_t total = 0;
+        for (size_t segment = 0; segment < max_segments; ++segment) {
+            if (segments_[segment].load(std::memory_order_acquire) != nullptr) {
+                total += segment_size(segment);
+            }
+        }
+        return total;
+    }
+    
+    Array<T> freeze() const& {
+        Array<T> result(size());
+        for_each([&result](const T& item) { result.push_back(item); });
+        return result;
+    }
+    
+    Array<T> freeze() && {
+        Array<T> result(size());
+        visit_slots([&result](size_t, Slot& slot) { result.push_back(std::move(*slot.get())); });
+        clear();
+        return result;
+    }
+    
+    void clear() {
+        size_t reserved = reserved_.load(std::memory_order_acquire);
+        for (size_t segment = 0, begin = 0; segment < max_segments; begin += segment_size(segment), ++segment) {
+            Slot* slots = segments_[segment].exchange(nullptr, std::memory_order_acq_rel);
+            if (slots == nullptr) {
+                continue;
+            }
+            size_t count = begin < reserved ? std::min(segment_size(segment), reserved - begin) : 0;
+            for (size_t offset = 0; offset < count; ++offset) {
+                if (slots[offset].ready(std::memory_order_relaxed)) {
+                    slots[offset].get()->~T();
+                }
+            }
+            std::free(slots);
+        }
+        reserved_.store(0, std::memory_order_release);
+        published_.store(0, std::memory_order_release);
+    }
+};
@@ -0,0 +1,209 @@
+#pragma once
+#include "Array.h"
+#include <atomic>
+#include <utility>
+#include <span>
+#include <iostream>
+
+template<class T>
+class CowArray {
+private:
+    struct Buffer {
+        Array<T> items;
+        std::atomic<size_t> owners{1};
+        
+        explicit Buffer(Array<T> array) : items(std::move(array)) {}
+    };
+    
+    Buffer* data_ = nullptr;
+    
+    static Buffer* retain(Buffer* buffer) noexcept {
+        if (buffer) {
+            buffer->owners.fetch_add(1, std::memory_order_relaxed);
+        }
+        return buffer;
+    }
+    
+    static void release(Buffer* buffer) noexcept {
+        if (buffer && buffer->owners.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete buffer;
+        }
+    }
+    
+    const Array<T>& shared() const {
+        static const Array<T> empty;
+        return data_ ? data_->items : empty;
+    }
+    
+    Array<T>& detach() {
+        if (!data_) {
+            data_ = new Buffer(Array<T>());
+        } else if (is_shared()) {
+            Buffer* copy = new Buffer(data_->items);
+            release(data_);
+            data_ = copy;
+        }
+        return data_->items;
+    }
+
+public:
+    using iterator = typename Array<T>::iterator;
+    using const_iterator = typename Array<T>::const_iterator;
+    
+    CowArray() : data_(new Buffer(Array<T>())) {}
+    
+    explicit CowArray(size_t initial_capacity) 
+        : data_(new Buffer(Array<T>(initial_capacity))) {}
+    
+    explicit CowArray(Array<T> array) 
+        : data_(new Buffer(std::move(array))) {}
+    
+    CowArray(const CowArray& other) : data_(retain(other.data_)) {}
+    
+    CowArray(CowArray&& other) noexcept : data_(std::exchange(other.data_, nullptr)) {}
+    
+    CowArray& operator=(const CowArray& other) {
+        if (this != &other) {
+            Buffer* buffer = retain(other.data_);
+            release(data_);
+            data_ = buffer;
+        }
+        return *this;
+    }
+    
+    CowArray& operator=(CowArray&& other) noexcept {
+        if (this != &other) {
+            release(data_);
+            data_ = std::exchange(other.data_, nullptr);
+        }
+        return *this;
+    }
+    
+    ~CowArray() {
+        release(data_);
+    }
+    
+    bool is_shared() const {
+        return data_ && data_->owners.load(std::memory_order_acquire) > 1;
+    }
+    
+    const Array<T>& array() const {
+        return shared();
+    }
+    
+    template<class... Args>
+    T& emplace_back(Args&&... args) {
+        return detach().emplace_back(std::forward<Args>(args)...);
+    }
+    
+    void push_back(const T& item) {
+        detach().push_back(item);
+    }
+    
+    void push_back(T&& item) {
+        detach().push_back(std::move(item));
+    }
+    
+    void pop_back() {
+        detach().pop_back();
+    }
+    
+    void remove(size_t index) {
+        if (index >= size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        detach().remove(index);
+    }
+    
+    void swap_remove(size_t index) {
+        if (index >= size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        detach().swap_remove(index);
+    }
+    
+    template<class Predicate>
+    size_t erase_if(Predicate predicate) {
+        return detach().erase_if(std::move(predicate));
+    }
+    
+    void remove_indices(std::span<const size_t> indices) {
+        detach().remove_indices(indices);
+    }
+    
+    void reserve(size_t new_capacity) {
+        detach().reserve(new_capacity);
+    }
+    
+    void clear() {
+        if (is_shared()) {
+            Buffer* buffer = new Buffer(Array<T>());
+            release(data_);
+            data_ = buffer;
+        } else {
+            detach().clear();
+        }
+    }
+    
+    T& operator[](size_t index) {
+        if (index >= size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        return detach()[index];
+    }
+    
+    const T& operator[](size_t index) const {
+        return shared()[index];
+    }
+    
+    T& at(size_t index) {
+        if (index >= size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        return detach().at(index);
+    }
+    
+    const T& at(size_t index) const {
+        return shared().at(index);
+    }
+    
+    size_t size() const {
+        return shared().size();
+    }
+    
+    size_t capacity() const {
+        return shared().capacity();
+    }
+    
+    bool empty() const {
+        return shared().empty();
+    }
+    
+    iterator begin() {
+        return detach().begin();
+    }
+    
+    iterator end() {
+        return detach().end();
+    }
+    
+    const_iterator begin() const {
+        return shared().begin();
+    }
+    
+    const_iterator end() const {
+        return shared().end();
+    }
+    
+    const_iterator cbegin() const {
+        return begin();
+    }
+    
+    const_iterator cend() const {
+        return end();
+    }
+    
+    friend std::ostream& operator<<(std::ostream& os, const CowArray& arr) {
+        return os << arr.shared();
+    }
+};
@@ -0,0 +1,102 @@
+#pragma once
+#include "Point.h"
+#include "BoundingBox.h"
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+template<IntegralScalar T>
+using ExactWide = std::conditional_t<(sizeof(T) <= 2), std::int64_t, __int128>;
+
+template<IntegralScalar T>
+struct RationalPoint {
+    ExactWide<T> x_numerator = 0;
+    ExactWide<T> y_numerator = 0;
+    ExactWide<T> denominator = 1;
+    
+    constexpr Point<double> to_point() const {
+        return Point<double>(static_cast<double>(x_numerator) / static_cast<double>(denominator),
+                             static_cast<double>(y_numerator) / static_cast<double>(denominator));
+    }
+    
+    constexpr bool operator==(const RationalPoint& other) const {
+        return x_numerator * other.denominator == other.x_numerator * denominator &&
+               y_numerator * other.denominator == other.y_numerator * denominator;
+    }
+    
+    constexpr bool operator!=(const RationalPoint& other) const {
+        return !(*this == other);
+    }
+};
+
+template<IntegralScalar T>
+constexpr ExactWide<T> twice_signed_area(std::span<const Point<T>> vertices) {
+    if (vertices.size() < 3) {
+        return 0;
+    }
+    
+    using Wide = ExactWide<T>;
+    if (vertices.size() == 4) {
+        std::int64_t diagonal1_x = std::int64_t(vertices[2].x()) - vertices[0].x();
+        std::int64_t diagonal1_y = std::int64_t(vertices[2].y()) - vertices[0].y();
+        std::int64_t diagonal2_x = std::int64_t(vertices[3].x()) - vertices[1].x();
+        std::int64_t diagonal2_y = std::int64_t(vertices[3].y()) - vertices[1].y();
+        return Wide(diagonal1_x) * diagonal2_y - Wide(diagonal2_x) * diagonal1_y;
+    }
+    
+    Wide origin_x = vertices[0].x();
+    Wide origin_y = vertices[0].y();
+    Wide total = 0;
+    for (size_t i = 1; i + 1 < vertices.size(); ++i) {
+        Wide ax = Wide(vertices[i].x()) - origin_x;
+        Wide ay = Wide(vertices[i].y()) - origin_y;
+        Wide bx = Wide(vertices[i + 1].x()) - origin_x;
+        Wide by = Wide(vertices[i + 1].y()) - origin_y;
+        total += ax * by - bx * ay;
+    }
+    return total;
+}
+
+template<IntegralScalar T>
+constexpr ExactWide<T> twice_area(std::span<const Point<T>> vertices) {
+    ExactWide<T> area = twice_signed_area(vertices);
+    return area < 0 ? -area : area;
+}
+
+template<IntegralScalar T>
+constexpr double exact_area(std::span<const Point<T>> vertices) {
+    ExactWide<T> area = twice_area(vertices);
+    if (area <= std::numeric_limits<std::int64_t>::max()) {
+        return static_cast<double>(static_cast<std::int64_t>(area)) / 2.0;
+    }
+    return static_cast<double>(area) / 2.0;
+}
+
+template<IntegralScalar T>
+constexpr RationalPoint<T> exact_center(std::span<const Point<T>> vertices) {
+    RationalPoint<T> center;
+    if (vertices.empty()) {
+        return center;
+    }
+    
+    for (const Point<T>& vertex : vertices) {
+        center.x_numerator += vertex.x();
+        center.y_numerator += vertex.y();
+    }
+    center.denominator = static_cast<ExactWide<T>>(vertices.size());
+    return center;
+}
+
+template<IntegralScalar T>
+constexpr BoundingBox<T> exact_bounding_box(std::span<const Point<T>> vertices) {
+    if (vertices.empty()) {
+        return BoundingBox<T>();
+    }
+    
+    BoundingBox<T> box(vertices[0]);
+    for (size_t i = 1; i < vertices.size(); ++i) {
+        box.expand(vertices[i]);
+    }
+    return box;
+}
@@ -1,13 +1,102 @@
 #pragma once
 #include "Point.h"
-#include <memory>
-#include <vector>
+#include "BoundingBox.h"
+#include "ExactGeometry.h"
+#include "AffineTransform.h"
+#include "FigureCacheStats.h"
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
 #include <iostream>
 
 template<Scalar T>
 class Figure {
+private:
+    static constexpr std::uint8_t area_ready = 1;
+    static constexpr std::uint8_t center_ready = 2;
+    static constexpr std::uint8_t box_ready = 4;
+    static constexpr std::uint8_t ready_mask = area_ready | center_ready | box_ready;
+    
+    mutable std::atomic<std::uint8_t> cache_state_{0};
+    mutable double cached_area_ = 0.0;
+    mutable Point<T> cached_center_;
+    mutable BoundingBox<T> cached_box_;
+    
+    template<class Value, class Compute>
+    Value cached(std::uint8_t ready, Value& slot, Compute&& compute) const {
+        if (cache_state_.load(std::memory_order_acquire) & ready) {
+            FigureCacheCounters::record_hit();
+            return slot;
+        }
+        
+        FigureCacheCounters::record_miss();
+        Value value = compute();
+        
+        std::uint8_t claimed = static_cast<std::uint8_t>(ready << 3);
+        std::uint8_t state = cache_state_.load(std::memory_order_relaxed);
+        while (!(state & (ready | claimed))) {
+            if (cache_state_.compare_exchange_weak(state, state | claimed, 
+                                                   std::memory_order_acquire, std::memory_order_relaxed)) {
+                slot = value;
+                cache_state_.fetch_or(ready, std::memory_order_release);
+                break;
+            }
+        }
+        return value;
+    }
+    
+    void copy_cache(const Figure& other) {
+        std::uint8_t ready = other.cache_state_.load(std::memory_order_acquire) & ready_mask;
+        if (ready & area_ready) {
+            cached_area_ = other.cached_area_;
+        }
+        if (ready & center_ready) {
+            cached_center_ = other.cached_center_;
+        }
+        if (ready & box_ready) {
+            cached_box_ = other.cached_box_;
+        }
+        cache_state_.store(static_cast<std::uint8_t>(ready | (ready << 3)), std::memory_order_release);
+    }
+
 protected:
-    std::vector<std::unique_ptr<Point<T>>> vertices_;
+    void invalidate_cache() noexcept {
+        cache_state_.store(0, std::memory_order_release);
+    }
+    
+    virtual double compute_area() const = 0;
+    
+    virtual Point<T> compute_center() const {
+        std::span<const Point<T>> points = vertices();
+        if (points.empty()) {
+            return Point<T>();
+        }
+        
+        T sum_x = T{};
+        T sum_y = T{};
+        
+        for (const auto& vertex : points) {
+            sum_x += vertex.x();
+            sum_y += vertex.y();
+        }
+        
+        return Point<T>(sum_x / static_cast<T>(points.size()), 
+                       sum_y / static_cast<T>(points.size()));
+    }
+    
+    BoundingBox<T> compute_bounding_box() const {
+        std::span<const Point<T>> points = vertices();
+        if (points.empty()) {
+            return BoundingBox<T>();
+        }
+        
+        BoundingBox<T> box(points[0]);
+        for (size_t i = 1; i < points.size(); ++i) {
+            box.expand(points[i]);
+        }
+        return box;
+    }
 
 public:
     Figure() = default;
@@ -15,67 +104,76 @@ public:
     virtual ~Figure() = default;
     
     Figure(const Figure& other) {
-        vertices_.reserve(other.vertices_.size());
-        for (const auto& vertex : other.vertices_) {
-            vertices_.push_back(std::make_unique<Point<T>>(*vertex));
-        }
+        copy_cache(other);
     }
     
-    Figure(Figure&& other) noexcept : vertices_(std::move(other.vertices_)) {}
+    Figure(Figure&& other) noexcept {
+        copy_cache(other);
+    }
     
     Figure& operator=(const Figure& other) {
         if (this != &other) {
-            vertices_.clear();
-            vertices_.reserve(other.vertices_.size());
-            for (const auto& vertex : other.vertices_) {
-                vertices_.push_back(std::make_unique<Point<T>>(*vertex));
-            }
+            invalidate_cache();
         }
         return *this;
     }
     
     Figure& operator=(Figure&& other) noexcept {
         if (this != &other) {
-            vertices_ = std::move(other.vertices_);
+            invalidate_cache();
         }
         return *this;
     }
     
-    virtual double area() const = 0;
+    virtual std::span<const Point<T>> vertices() const = 0;
     
-    virtual Point<T> center() const {
-        if (vertices_.empty()) {
-            return Point<T>();
-        }
-        
-        T sum_x = T{};
-        T sum_y = T{};
-        
-        for (const auto& vertex : vertices_) {
-            sum_x += vertex->x();
-            sum_y += vertex->y();
+    virtual bool try_transform(const AffineTransform& transform) = 0;
+    
+    void transform(const AffineTransform& transform) {
+        if (!try_transform(transform)) {
+            throw std::invalid_argument("Transform does not preserve the figure shape");
         }
-        
-        return Point<T>(sum_x / static_cast<T>(vertices_.size()), 
-                       sum_y / static_cast<T>(vertices_.size()));
+    }
+    
+    double area() const {
+        return cached(area_ready, cached_area_, [this] { return compute_area(); });
+    }
+    
+    Point<T> center() const {
+        return cached(center_ready, cached_center_, [this] { return compute_center(); });
+    }
+    
+    BoundingBox<T> bounding_box() const {
+        return cached(box_ready, cached_box_, [this] { return compute_bounding_box(); });
+    }
+    
+    auto twice_signed_area() const requires IntegralScalar<T> {
+        return ::twice_signed_area<T>(vertices());
+    }
+    
+    auto exact_center() const requires IntegralScalar<T> {
+        return ::exact_center<T>(vertices());
     }
     
     virtual void print_vertices(std::ostream& os) const {
-        for (size_t i = 0; i < vertices_.size(); ++i) {
-            os << "Vertex " << i + 1 << ": " << *vertices_[i];
-            if (i < vertices_.size() - 1) {
+        std::span<const Point<T>> points = vertices();
+        for (size_t i = 0; i < points.size(); ++i) {
+            os << "Vertex " << i + 1 << ": " << points[i];
+            if (i < points.size() - 1) {
                 os << ", ";
             }
         }
     }
     
     bool operator==(const Figure& other) const {
-        if (vertices_.size() != other.vertices_.size()) {
+        std::span<const Point<T>> points = vertices();
+        std::span<const Point<T>> other_points = other.vertices();
+        if (points.size() != other_points.size()) {
             return false;
         }
         
-        for (size_t i = 0; i < vertices_.size(); ++i) {
-            if (*vertices_[i] != *other.vertices_[i]) {
+        for (size_t i = 0; i < points.size(); ++i) {
+            if (points[i] != other_points[i]) {
                 return false;
             }
         }
@@ -92,11 +190,15 @@ public:
     }
     
     size_t vertex_count() const {
-        return vertices_.size();
+        return vertices().size();
     }
     
     const Point<T>& get_vertex(size_t index) const {
-        return *vertices_.at(index);
+        std::span<const Point<T>> points = vertices();
+        if (index >= points.size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        return points[index];
     }
     
     friend std::ostream& operator<<(std::ostream& os, const Figure& figure) {
@@ -0,0 +1,118 @@
+#pragma once
+#include "Figure.h"
+#include "Array.h"
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Not thread-safe: create, make_shared, make_array and release must not run
+// concurrently. Raw figures and arrays must not outlive release() or the arena;
+// shared handles may be dropped from any thread, but release() refuses to run
+// while any of them is alive.
+template<Scalar T>
+class FigureArena {
+public:
+    static constexpr size_t default_initial_size = 64 * 1024;
+
+private:
+    class SharedDeleter {
+    private:
+        std::atomic<size_t>* live_;
+        
+    public:
+        explicit SharedDeleter(std::atomic<size_t>* live) : live_(live) {}
+        
+        void operator()(Figure<T>* figure) const {
+            std::destroy_at(figure);
+            live_->fetch_sub(1, std::memory_order_release);
+        }
+    };
+    
+    std::pmr::monotonic_buffer_resource resource_;
+    std::vector<Figure<T>*> owned_;
+    std::atomic<size_t> live_shared_{0};
+    size_t created_ = 0;
+    
+    template<class Shape, class... Args>
+    Shape* construct(Args&&... args) {
+        void* storage = resource_.allocate(sizeof(Shape), alignof(Shape));
+        Shape* shape = ::new (storage) Shape(std::forward<Args>(args)...);
+        ++created_;
+        return shape;
+    }
+    
+    void destroy_owned() noexcept {
+        for (auto it = owned_.rbegin(); it != owned_.rend(); ++it) {
+            std::destroy_at(*it);
+        }
+        owned_.clear();
+    }
+
+public:
+    explicit FigureArena(size_t initial_size = default_initial_size, 
+                         std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) 
+        : resource_(initial_size, upstream) {}
+    
+    FigureArena(const FigureArena& other) = delete;
+    
+    FigureArena& operator=(const FigureArena& other) = delete;
+    
+    ~FigureArena() {
+        destroy_owned();
+    }
+    
+    std::pmr::memory_resource* resource() {
+        return &resource_;
+    }
+    
+    template<class Shape, class... Args>
+        requires std::derived_from<Shape, Figure<T>>
+    Shape* create(Args&&... args) {
+        owned_.push_back(nullptr);
+        try {
+            Shape* shape = construct<Shape>(std::forward<Args>(args)...);
+            owned_.back() = shape;
+            return shape;
+        } catch (...) {
+            owned_.pop_back();
+            throw;
+        }
+    }
+    
+    template<class Shape, class... Args>
+        requires std::derived_from<Shape, Figure<T>>
+    std::shared_ptr<Shape> make_shared(Args&&... args) {
+        Shape* shape = construct<Shape>(std::forward<Args>(args)...);
+        live_shared_.fetch_add(1, std::memory_order_relaxed);
+        return std::shared_ptr<Shape>(shape, SharedDeleter(&live_shared_),
+                                      std::pmr::polymorphic_allocator<Shape>(&resource_));
+    }
+    
+    template<class U>
+    PmrArray<U> make_array(size_t initial_capacity = 0) {
+        return PmrArray<U>(initial_capacity, std::pmr::polymorphic_allocator<U>(&resource_));
+    }
+    
+    size_t created() const {
+        return created_;
+    }
+    
+    size_t live_shared() const {
+        return live_shared_.load(std::memory_order_acquire);
+    }
+    
+    void release() {
+        if (live_shared() != 0) {
+            throw std::logic_error("Arena still has live shared figures");
+        }
+        destroy_owned();
+        resource_.release();
+        created_ = 0;
+    }
+};
@@ -0,0 +1,274 @@
+#pragma once
+#include "Point.h"
+#include "Figure.h"
+#include "Rectangle.h"
+#include "Trapezoid.h"
+#include "Rhombus.h"
+#include "Array.h"
+#include "FigureKind.h"
+#include "FigureStore.h"
+#include "SimdKernels.h"
+#include "ValidityBitmap.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace figure_batch_detail {
+
+constexpr size_t coordinates_per_figure = 8;
+constexpr size_t block_size = 256;
+using quad_value_detail::absolute_tolerance;
+using quad_value_detail::relative_tolerance;
+
+template<Scalar T>
+typename QuadValue<T>::Vertices vertices_at(const QuadColumns<T>& columns, size_t i) {
+    return {Point<T>(columns.x[0][i], columns.y[0][i]), Point<T>(columns.x[1][i], columns.y[1][i]),
+            Point<T>(columns.x[2][i], columns.y[2][i]), Point<T>(columns.x[3][i], columns.y[3][i])};
+}
+
+template<Scalar T>
+bool scalar_valid(const QuadColumns<T>& columns, size_t i) {
+    typename QuadValue<T>::Vertices vertices = vertices_at(columns, i);
+    switch (columns.kinds[i]) {
+        case FigureKind::Rectangle:
+            return RectangleValue<T>::is_valid(vertices);
+        case FigureKind::Rhombus:
+            return RhombusValue<T>::is_valid(vertices);
+        case FigureKind::Trapezoid:
+            return TrapezoidValue<T>::is_valid(vertices);
+    }
+    return false;
+}
+
+#if FIGURES_SIMD_X86
+
+FIGURES_TARGET_AVX2 inline __m256d avx2_squared(__m256d xa, __m256d ya, __m256d xb, __m256d yb) {
+    __m256d dx = _mm256_sub_pd(xa, xb);
+    __m256d dy = _mm256_sub_pd(ya, yb);
+    return _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+}
+
+FIGURES_TARGET_AVX2 inline __m256d avx2_nearly_equal(__m256d a, __m256d b) {
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    __m256d difference = _mm256_andnot_pd(sign, _mm256_sub_pd(a, b));
+    __m256d limit = _mm256_mul_pd(_mm256_set1_pd(relative_tolerance), _mm256_max_pd(a, b));
+    return _mm256_cmp_pd(difference, limit, _CMP_LE_OQ);
+}
+
+FIGURES_TARGET_AVX2 inline __m256d avx2_cross(__m256d ux, __m256d uy, __m256d vx, __m256d vy) {
+    return _mm256_sub_pd(_mm256_mul_pd(ux, vy), _mm256_mul_pd(uy, vx));
+}
+
+FIGURES_TARGET_AVX2 inline __m256d avx2_turns_one_way(__m256d x0, __m256d y0, __m256d x1, __m256d y1,
+                                                      __m256d x2, __m256d y2, __m256d x3, __m256d y3) {
+    __m256d ex0 = _mm256_sub_pd(x1, x0), ey0 = _mm256_sub_pd(y1, y0);
+    __m256d ex1 = _mm256_sub_pd(x2, x1), ey1 = _mm256_sub_pd(y2, y1);
+    __m256d ex2 = _mm256_sub_pd(x3, x2), ey2 = _mm256_sub_pd(y3, y2);
+    __m256d ex3 = _mm256_sub_pd(x0, x3), ey3 = _mm256_sub_pd(y0, y3);
+    __m256d crosses[4] = {avx2_cross(ex0, ey0, ex1, ey1), avx2_cross(ex1, ey1, ex2, ey2),
+                          avx2_cross(ex2, ey2, ex3, ey3), avx2_cross(ex3, ey3, ex0, ey0)};
+    
+    const __m256d zero = _mm256_setzero_pd();
+    __m256d left = _mm256_cmp_pd(crosses[0], zero, _CMP_GT_OQ);
+    __m256d right = _mm256_cmp_pd(crosses[0], zero, _CMP_LT_OQ);
+    for (size_t k = 1; k < 4; ++k) {
+        left = _mm256_and_pd(left, _mm256_cmp_pd(crosses[k], zero, _CMP_GT_OQ));
+        right = _mm256_and_pd(right, _mm256_cmp_pd(crosses[k], zero, _CMP_LT_OQ));
+    }
+    return _mm256_or_pd(left, right);
+}
+
+FIGURES_TARGET_AVX2 inline __m256d avx2_below(__m256d value, double limit) {
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    return _mm256_cmp_pd(_mm256_andnot_pd(sign, value), _mm256_set1_pd(limit), _CMP_LT_OQ);
+}
+
+template<simd_detail::Vectorizable T>
+FIGURES_TARGET_AVX2 size_t avx2_validate(const QuadColumns<T>& columns, size_t begin, size_t count, std::uint64_t& bits) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        size_t at = begin + i;
+        __m256d x0 = simd_detail::avx2_load(columns.x[0] + at), y0 = simd_detail::avx2_load(columns.y[0] + at);
+        __m256d x1 = simd_detail::avx2_load(columns.x[1] + at), y1 = simd_detail::avx2_load(columns.y[1] + at);
+        __m256d x2 = simd_detail::avx2_load(columns.x[2] + at), y2 = simd_detail::avx2_load(columns.y[2] + at);
+        __m256d x3 = simd_detail::avx2_load(columns.x[3] + at), y3 = simd_detail::avx2_load(columns.y[3] + at);
+        
+        std::int32_t packed_kinds;
+        std::memcpy(&packed_kinds, columns.kinds + at, sizeof(packed_kinds));
+        __m256i kinds = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(packed_kinds));
+        __m256d is_rectangle = simd_detail::avx2_kind_mask(kinds, FigureKind::Rectangle);
+        __m256d is_rhombus = simd_detail::avx2_kind_mask(kinds, FigureKind::Rhombus);
+        __m256d is_trapezoid = simd_detail::avx2_kind_mask(kinds, FigureKind::Trapezoid);
+        
+        __m256d s01 = avx2_squared(x0, y0, x1, y1);
+        __m256d s12 = avx2_squared(x1, y1, x2, y2);
+        __m256d s23 = avx2_squared(x2, y2, x3, y3);
+        __m256d s30 = avx2_squared(x3, y3, x0, y0);
+        
+        __m256d rectangle = _mm256_and_pd(_mm256_and_pd(avx2_nearly_equal(s01, s23), avx2_nearly_equal(s12, s30)),
+                                          _mm256_and_pd(avx2_nearly_equal(avx2_squared(x0, y0, x2, y2),
+                                                                          avx2_squared(x1, y1, x3, y3)),
+                                                        avx2_turns_one_way(x0, y0, x1, y1, x2, y2, x3, y3)));
+        
+        __m256d bisect_x = avx2_below(_mm256_sub_pd(_mm256_add_pd(x0, x2), _mm256_add_pd(x1, x3)), 4 * absolute_tolerance);
+        __m256d bisect_y = avx2_below(_mm256_sub_pd(_mm256_add_pd(y0, y2), _mm256_add_pd(y1, y3)), 4 * absolute_tolerance);
+        __m256d rhombus = _mm256_and_pd(_mm256_and_pd(avx2_nearly_equal(s01, s12), avx2_nearly_equal(s12, s23)),
+                                        _mm256_and_pd(avx2_nearly_equal(s23, s30), _mm256_and_pd(bisect_x, bisect_y)));
+        
+        __m256d height = _mm256_andnot_pd(_mm256_set1_pd(-0.0), _mm256_sub_pd(y0, y2));
+        __m256d bases = _mm256_mul_pd(_mm256_sub_pd(x1, x0), _mm256_sub_pd(x3, x2));
+        __m256d trapezoid = _mm256_and_pd(_mm256_and_pd(avx2_below(_mm256_sub_pd(y0, y1), absolute_tolerance),
+                                                        avx2_below(_mm256_sub_pd(y2, y3), absolute_tolerance)),
+                                          _mm256_and_pd(_mm256_cmp_pd(height, _mm256_set1_pd(absolute_tolerance), _CMP_GT_OQ),
+                                                        _mm256_cmp_pd(bases, _mm256_setzero_pd(), _CMP_LE_OQ)));
+        
+        __m256d valid = _mm256_or_pd(_mm256_or_pd(_mm256_and_pd(is_rectangle, rectangle), _mm256_and_pd(is_rhombus, rhombus)),
+                                     _mm256_and_pd(is_trapezoid, trapezoid));
+        bits |= static_cast<std::uint64_t>(_mm256_movemask_pd(valid)) << i;
+    }
+    return i;
+}
+
+#endif
+
+template<Scalar T>
+std::uint64_t validate_word(const QuadColumns<T>& columns, size_t begin, size_t count, SimdLevel level) {
+    std::uint64_t bits = 0;
+    size_t i = 0;
+#if FIGURES_SIMD_X86
+    if constexpr (simd_detail::Vectorizable<T>) {
+        if (level == SimdLevel::AVX2) {
+            i = avx2_validate(columns, begin, count, bits);
+        }
+    }
+#endif
+    for (; i < count; ++i) {
+        bits |= static_cast<std::uint64_t>(scalar_valid(columns, begin + i)) << i;
+    }
+    return bits;
+}
+
+template<Scalar T>
+void validate_into(const QuadColumns<T>& columns, ValidityBitmap& valid, size_t first, SimdLevel level) {
+    for (size_t begin = 0; begin < columns.count; begin += ValidityBitmap::bits_per_word) {
+        size_t count = std::min(ValidityBitmap::bits_per_word, columns.count - begin);
+        valid.set_word((first + begin) / ValidityBitmap::bits_per_word, validate_word(columns, begin, count, level));
+    }
+}
+
+template<Scalar T, class Visitor>
+void for_each_block(FigureKind kind, std::span<const T> coordinates, Visitor&& visitor) {
+    if (coordinates.size() % coordinates_per_figure != 0) {
+        throw std::invalid_argument("Coordinate count must be a multiple of 8");
+    }
+    
+    FigureKind kinds[block_size];
+    T xs[4][block_size];
+    T ys[4][block_size];
+    std::fill(kinds, kinds + block_size, kind);
+    
+    QuadColumns<T> columns;
+    columns.kinds = kinds;
+    for (size_t k = 0; k < 4; ++k) {
+        columns.x[k] = xs[k];
+        columns.y[k] = ys[k];
+    }
+    
+    size_t count = coordinates.size() / coordinates_per_figure;
+    for (size_t first = 0; first < count; first += block_size) {
+        columns.count = std::min(block_size, count - first);
+        const T* source = coordinates.data() + first * coordinates_per_figure;
+        for (size_t i = 0; i < columns.count; ++i) {
+            for (size_t k = 0; k < 4; ++k) {
+                xs[k][i] = source[i * coordinates_per_figure + 2 * k];
+                ys[k][i] = source[i * coordinates_per_figure + 2 * k + 1];
+            }
+        }
+        visitor(columns, first);
+    }
+}
+
+template<Scalar T>
+void append(FigureStore<T>& store, FigureKind kind, const typename QuadValue<T>::Vertices& vertices) {
+    switch (kind) {
+        case FigureKind::Rectangle:
+            store.push_back(RectangleValue<T>::from_validated(vertices));
+            break;
+        case FigureKind::Trapezoid:
+            store.push_back(TrapezoidValue<T>::from_validated(vertices));
+            break;
+        case FigureKind::Rhombus:
+            store.push_back(RhombusValue<T>::from_validated(vertices));
+            break;
+    }
+}
+
+template<Scalar T, class... Policies>
+void append(Array<std::shared_ptr<Figure<T>>, Policies...>& figures, FigureKind kind,
+            const typename QuadValue<T>::Vertices& vertices) {
+    switch (kind) {
+        case FigureKind::Rectangle:
+            figures.push_back(std::make_shared<Rectangle<T>>(RectangleValue<T>::from_validated(vertices)));
+            break;
+        case FigureKind::Trapezoid:
+            figures.push_back(std::make_shared<Trapezoid<T>>(TrapezoidValue<T>::from_validated(vertices)));
+            break;
+        case FigureKind::Rhombus:
+            figures.push_back(std::make_shared<Rhombus<T>>(RhombusValue<T>::from_validated(vertices)));
+            break;
+    }
+}
+
+template<Scalar T, class Output>
+ValidityBitmap append_valid(FigureKind kind, std::span<const T> coordinates, Output& output, SimdLevel level) {
+    level = std::min(level, detected_simd_level());
+    ValidityBitmap valid(coordinates.size() / coordinates_per_figure);
+    output.reserve(output.size() + valid.size());
+    for_each_block(kind, coordinates, [&](const QuadColumns<T>& columns, size_t first) {
+        validate_into(columns, valid, first, level);
+        for (size_t i = 0; i < columns.count; ++i) {
+            if (valid[first + i]) {
+                append(output, kind, vertices_at(columns, i));
+            }
+        }
+    });
+    return valid;
+}
+
+}
+
+template<Scalar T>
+ValidityBitmap batch_validate(const QuadColumns<T>& columns, SimdLevel level = detected_simd_level()) {
+    level = std::min(level, detected_simd_level());
+    ValidityBitmap valid(columns.count);
+    figure_batch_detail::validate_into(columns, valid, 0, level);
+    return valid;
+}
+
+template<Scalar T>
+ValidityBitmap batch_validate(FigureKind kind, std::span<const T> coordinates, SimdLevel level = detected_simd_level()) {
+    level = std::min(level, detected_simd_level());
+    ValidityBitmap valid(coordinates.size() / figure_batch_detail::coordinates_per_figure);
+    figure_batch_detail::for_each_block(kind, coordinates, [&](const QuadColumns<T>& columns, size_t first) {
+        figure_batch_detail::validate_into(columns, valid, first, level);
+    });
+    return valid;
+}
+
+template<Scalar T>
+ValidityBitmap batch_append(FigureKind kind, std::type_identity_t<std::span<const T>> coordinates, FigureStore<T>& store,
+                            SimdLevel level = detected_simd_level()) {
+    return figure_batch_detail::append_valid(kind, coordinates, store, level);
+}
+
+template<Scalar T, class... Policies>
+ValidityBitmap batch_append(FigureKind kind, std::type_identity_t<std::span<const T>> coordinates,
+                            Array<std::shared_ptr<Figure<T>>, Policies...>& figures,
+                            SimdLevel level = detected_simd_level()) {
+    return figure_batch_detail::append_valid(kind, coordinates, figures, level);
+}
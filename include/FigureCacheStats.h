@@ -0,0 +1,68 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+struct FigureCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    
+    double hit_rate() const {
+        std::uint64_t total = hits + misses;
+        return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+    }
+};
+
+namespace figure_cache_detail {
+
+struct alignas(64) CounterShard {
+    std::atomic<std::uint64_t> hits{0};
+    std::atomic<std::uint64_t> misses{0};
+};
+
+}
+
+class FigureCacheCounters {
+private:
+    using Shard = figure_cache_detail::CounterShard;
+    
+    static constexpr size_t shard_count = 64;
+    
+    static inline std::array<Shard, shard_count> shards_{};
+    static inline std::atomic<size_t> next_shard_{0};
+    
+    static Shard& local_shard() {
+        thread_local size_t index = next_shard_.fetch_add(1, std::memory_order_relaxed) % shard_count;
+        return shards_[index];
+    }
+    
+    static void bump(std::atomic<std::uint64_t>& counter) {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+public:
+    static void record_hit() {
+        bump(local_shard().hits);
+    }
+    
+    static void record_miss() {
+        bump(local_shard().misses);
+    }
+    
+    static FigureCacheStats snapshot() {
+        FigureCacheStats stats;
+        for (const Shard& shard : shards_) {
+            stats.hits += shard.hits.load(std::memory_order_relaxed);
+            stats.misses += shard.misses.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+    
+    static void reset() {
+        for (Shard& shard : shards_) {
+            shard.hits.store(0, std::memory_order_relaxed);
+            shard.misses.store(0, std::memory_order_relaxed);
+        }
+    }
+};
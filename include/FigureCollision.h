@@ -0,0 +1,111 @@
+#pragma once
+#include "Point.h"
+#include "ExactGeometry.h"
+#include "Figure.h"
+#include "Array.h"
+#include "FigureStore.h"
+#include "FigureBatch.h"
+#include "SweepAndPrune.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace figure_collision_detail {
+
+template<Scalar T>
+struct Projection {
+    using type = double;
+};
+
+template<IntegralScalar T>
+struct Projection<T> {
+    using type = ExactWide<T>;
+};
+
+template<Scalar T>
+bool separated_by_edges(std::span<const Point<T>> a, std::span<const Point<T>> b) {
+    using Wide = typename Projection<T>::type;
+    
+    for (size_t i = 0; i < a.size(); ++i) {
+        const Point<T>& p = a[i];
+        const Point<T>& q = a[i + 1 < a.size() ? i + 1 : 0];
+        Wide normal_x = Wide(p.y()) - Wide(q.y());
+        Wide normal_y = Wide(q.x()) - Wide(p.x());
+        
+        auto project = [&](const Point<T>& point) { return normal_x * Wide(point.x()) + normal_y * Wide(point.y()); };
+        Wide min_a = project(a[0]);
+        Wide max_a = min_a;
+        for (size_t k = 1; k < a.size(); ++k) {
+            Wide value = project(a[k]);
+            min_a = std::min(min_a, value);
+            max_a = std::max(max_a, value);
+        }
+        Wide min_b = project(b[0]);
+        Wide max_b = min_b;
+        for (size_t k = 1; k < b.size(); ++k) {
+            Wide value = project(b[k]);
+            min_b = std::min(min_b, value);
+            max_b = std::max(max_b, value);
+        }
+        
+        if (max_a < min_b || max_b < min_a) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}
+
+template<Scalar T>
+bool convex_overlap(std::span<const Point<T>> a, std::span<const Point<T>> b) {
+    if (a.empty() || b.empty()) {
+        return false;
+    }
+    return !figure_collision_detail::separated_by_edges(a, b) && !figure_collision_detail::separated_by_edges(b, a);
+}
+
+template<Scalar T>
+bool convex_overlap(const Figure<T>& a, const Figure<T>& b) {
+    return a.bounding_box().intersects(b.bounding_box()) && convex_overlap(a.vertices(), b.vertices());
+}
+
+template<Scalar T, class... Policies>
+std::vector<FigurePair> overlapping_pairs(const Array<std::shared_ptr<Figure<T>>, Policies...>& figures,
+                                          const SweepAndPrune<T>& broad_phase) {
+    return broad_phase.pairs_if([&figures](size_t a, size_t b) {
+        return convex_overlap(figures[a]->vertices(), figures[b]->vertices());
+    });
+}
+
+template<Scalar T, class... Policies>
+std::vector<FigurePair> overlapping_pairs(const Array<std::shared_ptr<Figure<T>>, Policies...>& figures,
+                                          const SweepAndPrune<T>& broad_phase, ThreadPool& pool,
+                                          size_t block_size = SweepAndPrune<T>::default_block_size) {
+    return broad_phase.pairs_if(pool, [&figures](size_t a, size_t b) {
+        return convex_overlap(figures[a]->vertices(), figures[b]->vertices());
+    }, block_size);
+}
+
+template<Scalar T>
+std::vector<FigurePair> overlapping_pairs(const FigureStore<T>& store, const SweepAndPrune<T>& broad_phase) {
+    QuadColumns<T> columns = store.columns();
+    return broad_phase.pairs_if([&columns](size_t a, size_t b) {
+        auto first = figure_batch_detail::vertices_at(columns, a);
+        auto second = figure_batch_detail::vertices_at(columns, b);
+        return convex_overlap<T>(first, second);
+    });
+}
+
+template<Scalar T>
+std::vector<FigurePair> overlapping_pairs(const FigureStore<T>& store, const SweepAndPrune<T>& broad_phase,
+                                          ThreadPool& pool, size_t block_size = SweepAndPrune<T>::default_block_size) {
+    QuadColumns<T> columns = store.columns();
+    return broad_phase.pairs_if(pool, [&columns](size_t a, size_t b) {
+        auto first = figure_batch_detail::vertices_at(columns, a);
+        auto second = figure_batch_detail::vertices_at(columns, b);
+        return convex_overlap<T>(first, second);
+    }, block_size);
+}
@@ -0,0 +1,187 @@
+#pragma once
+#include "Point.h"
+#include "Figure.h"
+#include "Array.h"
+#include "FigureKind.h"
+#include "FigureStore.h"
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+enum class FigureScalarType : std::uint8_t {
+    Int32 = 1,
+    Float32 = 2,
+    Float64 = 3
+};
+
+enum class FigureFileValidation {
+    None,
+    Lazy,
+    Eager
+};
+
+struct FigureFileHeader {
+    static constexpr std::array<char, 4> magic = {'F', 'I', 'G', 'S'};
+    static constexpr std::uint16_t current_version = 1;
+    static constexpr size_t encoded_size = 96;
+    static constexpr size_t column_alignment = 64;
+    static constexpr size_t column_count = 9;
+    
+    std::uint16_t version = current_version;
+    FigureScalarType scalar_type = FigureScalarType::Float64;
+    std::uint8_t vertices_per_figure = 4;
+    std::uint64_t count = 0;
+    std::array<std::uint64_t, column_count> offsets{};
+};
+
+namespace figure_file_detail {
+
+template<Scalar T>
+constexpr FigureScalarType scalar_type() {
+    if constexpr (std::is_same_v<T, int> && sizeof(int) == 4) {
+        return FigureScalarType::Int32;
+    } else if constexpr (std::is_same_v<T, float>) {
+        return FigureScalarType::Float32;
+    } else if constexpr (std::is_same_v<T, double>) {
+        return FigureScalarType::Float64;
+    } else {
+        static_assert(!sizeof(T), "Figure files support int, float and double coordinates");
+    }
+}
+
+template<class U>
+void store_le(unsigned char* out, U value) {
+    for (size_t i = 0; i < sizeof(U); ++i) {
+        out[i] = static_cast<unsigned char>(value >> (8 * i));
+    }
+}
+
+template<class U>
+U load_le(const unsigned char* in) {
+    U value = 0;
+    for (size_t i = 0; i < sizeof(U); ++i) {
+        value |= static_cast<U>(in[i]) << (8 * i);
+    }
+    return value;
+}
+
+inline size_t align_up(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+inline std::array<unsigned char, FigureFileHeader::encoded_size> encode_header(const FigureFileHeader& header) {
+    std::array<unsigned char, FigureFileHeader::encoded_size> bytes{};
+    std::memcpy(bytes.data(), FigureFileHeader::magic.data(), FigureFileHeader::magic.size());
+    store_le(bytes.data() + 4, header.version);
+    bytes[6] = static_cast<unsigned char>(header.scalar_type);
+    bytes[7] = header.vertices_per_figure;
+    store_le(bytes.data() + 8, header.count);
+    for (size_t c = 0; c < FigureFileHeader::column_count; ++c) {
+        store_le(bytes.data() + 16 + 8 * c, header.offsets[c]);
+    }
+    return bytes;
+}
+
+inline FigureFileHeader decode_header(const unsigned char* bytes, size_t size) {
+    if (size < FigureFileHeader::encoded_size ||
+        std::memcmp(bytes, FigureFileHeader::magic.data(), FigureFileHeader::magic.size()) != 0) {
+        throw std::runtime_error("Not a figure file");
+    }
+    
+    FigureFileHeader header;
+    header.version = load_le<std::uint16_t>(bytes + 4);
+    header.scalar_type = static_cast<FigureScalarType>(bytes[6]);
+    header.vertices_per_figure = bytes[7];
+    header.count = load_le<std::uint64_t>(bytes + 8);
+    for (size_t c = 0; c < FigureFileHeader::column_count; ++c) {
+        header.offsets[c] = load_le<std::uint64_t>(bytes + 16 + 8 * c);
+    }
+    
+    if (header.version != FigureFileHeader::current_version) {
+        throw std::runtime_error("Unsupported figure file version");
+    }
+    return header;
+}
+
+template<Scalar T>
+void write_column(std::ofstream& out, const T* values, size_t count) {
+    if constexpr (std::endian::native == std::endian::little) {
+        out.write(reinterpret_cast<const char*>(values), static_cast<std::streamsize>(count * sizeof(T)));
+    } else {
+        using Bits = std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>;
+        std::array<unsigned char, sizeof(T)> bytes;
+        for (size_t i = 0; i < count; ++i) {
+            store_le(bytes.data(), std::bit_cast<Bits>(values[i]));
+            out.write(reinterpret_cast<const char*>(bytes.data()), sizeof(T));
+        }
+    }
+}
+
+inline void pad_to(std::ofstream& out, size_t& position, size_t offset) {
+    static const char zeros[FigureFileHeader::column_alignment] = {};
+    out.write(zeros, static_cast<std::streamsize>(offset - position));
+    position = offset;
+}
+
+}
+
+template<Scalar T>
+void write_figure_file(const std::string& path, const FigureStore<T>& store) {
+    FigureFileHeader header;
+    header.scalar_type = figure_file_detail::scalar_type<T>();
+    header.count = store.size();
+    
+    size_t offset = figure_file_detail::align_up(FigureFileHeader::encoded_size, FigureFileHeader::column_alignment);
+    header.offsets[0] = offset;
+    offset = figure_file_detail::align_up(offset + store.size(), FigureFileHeader::column_alignment);
+    for (size_t c = 1; c < FigureFileHeader::column_count; ++c) {
+        header.offsets[c] = offset;
+        offset = figure_file_detail::align_up(offset + store.size() * sizeof(T), FigureFileHeader::column_alignment);
+    }
+    
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot open figure file for writing: " + path);
+    }
+    
+    auto bytes = figure_file_detail::encode_header(header);
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    size_t position = bytes.size();
+    
+    figure_file_detail::pad_to(out, position, header.offsets[0]);
+    out.write(reinterpret_cast<const char*>(store.kind_data()), static_cast<std::streamsize>(store.size()));
+    position += store.size();
+    
+    for (size_t k = 0; k < FigureStore<T>::vertices_per_figure; ++k) {
+        figure_file_detail::pad_to(out, position, header.offsets[1 + k]);
+        figure_file_detail::write_column(out, store.x_data(k), store.size());
+        position += store.size() * sizeof(T);
+    }
+    for (size_t k = 0; k < FigureStore<T>::vertices_per_figure; ++k) {
+        figure_file_detail::pad_to(out, position, header.offsets[5 + k]);
+        figure_file_detail::write_column(out, store.y_data(k), store.size());
+        position += store.size() * sizeof(T);
+    }
+    figure_file_detail::pad_to(out, position, offset);
+    
+    if (!out.flush()) {
+        throw std::runtime_error("Failed to write figure file: " + path);
+    }
+}
+
+template<Scalar T, class... Policies>
+void write_figure_file(const std::string& path, const Array<std::shared_ptr<Figure<T>>, Policies...>& figures) {
+    FigureStore<T> store;
+    store.reserve(figures.size());
+    for (size_t i = 0; i < figures.size(); ++i) {
+        store.push_back(*figures[i]);
+    }
+    write_figure_file(path, store);
+}
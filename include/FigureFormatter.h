@@ -0,0 +1,194 @@
+#pragma once
+#include "Point.h"
+#include "Figure.h"
+#include "Rectangle.h"
+#include "Trapezoid.h"
+#include "Rhombus.h"
+#include "Array.h"
+#include "FigureKind.h"
+#include "FigureStore.h"
+#include <array>
+#include <charconv>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+enum class FigureFormat {
+    Human,
+    Csv,
+    JsonLines
+};
+
+template<Scalar T>
+class FigureFormatter {
+private:
+    FigureFormat format_;
+    
+    template<class V>
+    void append_number(std::string& out, V value) const {
+        char buffer[64];
+        std::to_chars_result result;
+        if constexpr (std::is_floating_point_v<V>) {
+            if (format_ == FigureFormat::Human) {
+                result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, 6);
+            } else {
+                result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            }
+        } else {
+            result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        }
+        out.append(buffer, result.ptr);
+    }
+    
+    void append_human_point(std::string& out, const Point<T>& point) const {
+        out += '(';
+        append_number(out, point.x());
+        out += ", ";
+        append_number(out, point.y());
+        out += ')';
+    }
+    
+    void append_json_point(std::string& out, const Point<T>& point) const {
+        out += '[';
+        append_number(out, point.x());
+        out += ',';
+        append_number(out, point.y());
+        out += ']';
+    }
+    
+    static std::string_view kind_name(const Figure<T>& figure) {
+        if (dynamic_cast<const Rectangle<T>*>(&figure)) {
+            return "rectangle";
+        } else if (dynamic_cast<const Trapezoid<T>*>(&figure)) {
+            return "trapezoid";
+        } else if (dynamic_cast<const Rhombus<T>*>(&figure)) {
+            return "rhombus";
+        }
+        return "figure";
+    }
+    
+    static std::string_view kind_name(FigureKind kind) {
+        switch (kind) {
+            case FigureKind::Rectangle:
+                return "rectangle";
+            case FigureKind::Trapezoid:
+                return "trapezoid";
+            case FigureKind::Rhombus:
+                return "rhombus";
+        }
+        return "figure";
+    }
+    
+    void append_record(std::string& out, std::string_view kind, const Point<T>& center, double area,
+                       std::span<const Point<T>> vertices) const {
+        switch (format_) {
+            case FigureFormat::Human:
+                out += "Center: ";
+                append_human_point(out, center);
+                out += ", Area: ";
+                append_number(out, area);
+                out += ", Vertices: ";
+                for (size_t i = 0; i < vertices.size(); ++i) {
+                    out += "Vertex ";
+                    append_number(out, i + 1);
+                    out += ": ";
+                    append_human_point(out, vertices[i]);
+                    if (i < vertices.size() - 1) {
+                        out += ", ";
+                    }
+                }
+                break;
+            case FigureFormat::Csv:
+                out += kind;
+                out += ',';
+                append_number(out, center.x());
+                out += ',';
+                append_number(out, center.y());
+                out += ',';
+                append_number(out, area);
+                for (const Point<T>& vertex : vertices) {
+                    out += ',';
+                    append_number(out, vertex.x());
+                    out += ',';
+                    append_number(out, vertex.y());
+                }
+                out += '\n';
+                break;
+            case FigureFormat::JsonLines:
+                out += "{\"kind\":\"";
+                out += kind;
+                out += "\",\"center\":";
+                append_json_point(out, center);
+                out += ",\"area\":";
+                append_number(out, area);
+                out += ",\"vertices\":[";
+                for (size_t i = 0; i < vertices.size(); ++i) {
+                    if (i > 0) {
+                        out += ',';
+                    }
+                    append_json_point(out, vertices[i]);
+                }
+                out += "]}\n";
+                break;
+        }
+    }
+
+public:
+    explicit FigureFormatter(FigureFormat format = FigureFormat::Human) : format_(format) {}
+    
+    FigureFormat format() const {
+        return format_;
+    }
+    
+    void append_header(std::string& out) const {
+        if (format_ == FigureFormat::Csv) {
+            out += "kind,center_x,center_y,area,x1,y1,x2,y2,x3,y3,x4,y4\n";
+        }
+    }
+    
+    void append(std::string& out, const Figure<T>& figure) const {
+        append_record(out, format_ == FigureFormat::Human ? std::string_view() : kind_name(figure),
+                      figure.center(), figure.area(), figure.vertices());
+    }
+    
+    template<class... Policies>
+    void append(std::string& out, const Array<std::shared_ptr<Figure<T>>, Policies...>& figures) const {
+        if (format_ == FigureFormat::Human) {
+            out += '[';
+        }
+        for (size_t i = 0; i < figures.size(); ++i) {
+            append(out, *figures[i]);
+            if (format_ == FigureFormat::Human && i < figures.size() - 1) {
+                out += ", ";
+            }
+        }
+        if (format_ == FigureFormat::Human) {
+            out += ']';
+        }
+    }
+    
+    void append(std::string& out, const typename FigureStore<T>::FigureRef& figure) const {
+        std::array<Point<T>, FigureStore<T>::vertices_per_figure> vertices;
+        for (size_t k = 0; k < vertices.size(); ++k) {
+            vertices[k] = figure.get_vertex(k);
+        }
+        append_record(out, kind_name(figure.kind()), figure.center(), figure.area(), vertices);
+    }
+    
+    void append(std::string& out, const FigureStore<T>& store) const {
+        for (auto figure : store) {
+            append(out, figure);
+            if (format_ == FigureFormat::Human) {
+                out += '\n';
+            }
+        }
+    }
+    
+    std::string to_string(const Figure<T>& figure) const {
+        std::string out;
+        append(out, figure);
+        return out;
+    }
+};
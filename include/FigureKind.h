@@ -0,0 +1,8 @@
+#pragma once
+#include <cstdint>
+
+enum class FigureKind : std::uint8_t {
+    Rectangle,
+    Trapezoid,
+    Rhombus
+};
@@ -0,0 +1,227 @@
+#pragma once
+#include "Point.h"
+#include "Figure.h"
+#include "Rectangle.h"
+#include "Trapezoid.h"
+#include "Rhombus.h"
+#include "Array.h"
+#include "FigureStore.h"
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+struct FigureParseError {
+    size_t line;
+    std::string message;
+};
+
+struct FigureParseResult {
+    size_t lines = 0;
+    size_t figures = 0;
+    std::vector<FigureParseError> errors;
+    
+    bool ok() const {
+        return errors.empty();
+    }
+};
+
+namespace figure_parser_detail {
+
+inline bool is_separator(char c) {
+    return c == ' ' || c == '\t' || c == ',' || c == '\r';
+}
+
+inline std::string_view next_token(std::string_view& line) {
+    size_t begin = 0;
+    while (begin < line.size() && is_separator(line[begin])) {
+        ++begin;
+    }
+    size_t end = begin;
+    while (end < line.size() && !is_separator(line[end])) {
+        ++end;
+    }
+    std::string_view token = line.substr(begin, end - begin);
+    line.remove_prefix(end);
+    return token;
+}
+
+template<Scalar T, class Shape>
+void emit(FigureStore<T>& store, Shape&& shape) {
+    store.push_back(shape);
+}
+
+template<Scalar T, class Shape, class... Policies>
+void emit(Array<std::shared_ptr<Figure<T>>, Policies...>& figures, Shape&& shape) {
+    figures.push_back(std::make_shared<std::decay_t<Shape>>(std::forward<Shape>(shape)));
+}
+
+template<Scalar T, class Consumer, class Shape>
+void emit(Consumer& consumer, Shape&& shape) {
+    consumer(std::forward<Shape>(shape));
+}
+
+}
+
+template<Scalar T>
+class FigureParser {
+public:
+    static constexpr size_t max_values = 8;
+    static constexpr size_t default_chunk_size = size_t(1) << 20;
+
+private:
+    size_t chunk_size_;
+    std::string pending_;
+    FigureParseResult result_;
+    
+    void error(std::string message) {
+        result_.errors.push_back(FigureParseError{result_.lines, std::move(message)});
+    }
+    
+    template<class Shape, class Consumer>
+    void build(Consumer& consumer, const std::array<T, max_values>& v, size_t count, size_t center_count) {
+        if (count == max_values) {
+            figure_parser_detail::emit<T>(consumer, Shape(v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7]));
+        } else if (count == center_count) {
+            if constexpr (std::is_same_v<Shape, Trapezoid<T>>) {
+                figure_parser_detail::emit<T>(consumer, Shape(Point<T>(v[0], v[1]), v[2], v[3], v[4]));
+            } else {
+                figure_parser_detail::emit<T>(consumer, Shape(Point<T>(v[0], v[1]), v[2], v[3]));
+            }
+        } else {
+            error("Expected " + std::to_string(center_count) + " or 8 values, got " + std::to_string(count));
+            return;
+        }
+        ++result_.figures;
+    }
+    
+    template<class Consumer>
+    void parse_line(std::string_view line, Consumer& consumer) {
+        ++result_.lines;
+        
+        std::string_view kind = figure_parser_detail::next_token(line);
+        if (kind.empty() || kind[0] == '#') {
+            return;
+        }
+        
+        std::array<T, max_values> values{};
+        size_t count = 0;
+        for (std::string_view token = figure_parser_detail::next_token(line); !token.empty();
+             token = figure_parser_detail::next_token(line)) {
+            if (count == max_values) {
+                error("Too many values");
+                return;
+            }
+            
+            const char* end = token.data() + token.size();
+            auto [ptr, ec] = std::from_chars(token.data(), end, values[count]);
+            if (ec != std::errc() || ptr != end) {
+                error("Invalid number '" + std::string(token) + "'");
+                return;
+            }
+            ++count;
+        }
+        
+        try {
+            if (kind == "rectangle") {
+                build<Rectangle<T>>(consumer, values, count, 4);
+            } else if (kind == "trapezoid") {
+                build<Trapezoid<T>>(consumer, values, count, 5);
+            } else if (kind == "rhombus") {
+                build<Rhombus<T>>(consumer, values, count, 4);
+            } else {
+                error("Unknown figure kind '" + std::string(kind) + "'");
+            }
+        } catch (const std::invalid_argument& e) {
+            error(e.what());
+        }
+    }
+
+public:
+    explicit FigureParser(size_t chunk_size = default_chunk_size) : chunk_size_(chunk_size) {
+        if (chunk_size == 0) {
+            throw std::invalid_argument("Chunk size must be positive");
+        }
+    }
+    
+    template<class Consumer>
+    void feed(std::string_view chunk, Consumer&& consumer) {
+        if (!pending_.empty()) {
+            size_t newline = chunk.find('\n');
+            if (newline == std::string_view::npos) {
+                pending_.append(chunk);
+                return;
+            }
+            pending_.append(chunk.substr(0, newline));
+            parse_line(pending_, consumer);
+            pending_.clear();
+            chunk.remove_prefix(newline + 1);
+        }
+        
+        for (size_t newline = chunk.find('\n'); newline != std::string_view::npos; newline = chunk.find('\n')) {
+            parse_line(chunk.substr(0, newline), consumer);
+            chunk.remove_prefix(newline + 1);
+        }
+        pending_.assign(chunk);
+    }
+    
+    template<class Consumer>
+    FigureParseResult finish(Consumer&& consumer) {
+        if (!pending_.empty()) {
+            parse_line(pending_, consumer);
+            pending_.clear();
+        }
+        return std::exchange(result_, FigureParseResult());
+    }
+    
+    template<class Consumer>
+    FigureParseResult parse(std::string_view text, Consumer&& consumer) {
+        feed(text, consumer);
+        return finish(consumer);
+    }
+    
+    template<class Consumer>
+    FigureParseResult parse_fd(int fd, Consumer&& consumer) {
+        std::vector<char> buffer(chunk_size_);
+        while (true) {
+            ssize_t bytes = ::read(fd, buffer.data(), buffer.size());
+            if (bytes < 0 && errno == EINTR) {
+                continue;
+            }
+            if (bytes < 0) {
+                pending_.clear();
+                result_ = FigureParseResult();
+                throw std::runtime_error("Failed to read figure input");
+            }
+            if (bytes == 0) {
+                break;
+            }
+            feed(std::string_view(buffer.data(), static_cast<size_t>(bytes)), consumer);
+        }
+        return finish(consumer);
+    }
+    
+    template<class Consumer>
+    FigureParseResult parse_file(const std::string& path, Consumer&& consumer) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open figure file: " + path);
+        }
+        try {
+            FigureParseResult result = parse_fd(fd, consumer);
+            ::close(fd);
+            return result;
+        } catch (...) {
+            ::close(fd);
+            throw;
+        }
+    }
+};
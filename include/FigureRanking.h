@@ -0,0 +1,331 @@
+#pragma once
+#include "Point.h"
+#include "Figure.h"
+#include "Array.h"
+#include "FigureStore.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+enum class FigureKey {
+    Area,
+    CenterX,
+    CenterY
+};
+
+enum class SortOrder {
+    Ascending,
+    Descending
+};
+
+namespace figure_ranking_detail {
+
+constexpr size_t radix_bits = 8;
+constexpr size_t radix_buckets = size_t(1) << radix_bits;
+constexpr size_t min_block_size = 1 << 15;
+
+struct Blocks {
+    size_t count = 1;
+    size_t size = 0;
+    
+    size_t begin(size_t block) const {
+        return block * size;
+    }
+    
+    size_t end(size_t block, size_t total) const {
+        return std::min(total, (block + 1) * size);
+    }
+};
+
+inline Blocks split(size_t count, ThreadPool& pool) {
+    Blocks blocks;
+    blocks.count = std::clamp<size_t>(count / min_block_size, 1, pool.thread_count() * 4);
+    blocks.size = std::max<size_t>(1, (count + blocks.count - 1) / blocks.count);
+    blocks.count = std::max<size_t>(1, (count + blocks.size - 1) / blocks.size);
+    return blocks;
+}
+
+inline std::uint64_t order_key(double value, SortOrder order) {
+    std::uint64_t bits = std::bit_cast<std::uint64_t>(value == 0.0 ? 0.0 : value);
+    bits = (bits >> 63) != 0 ? ~bits : bits | (std::uint64_t(1) << 63);
+    return order == SortOrder::Ascending ? bits : ~bits;
+}
+
+struct RankedKeys {
+    std::vector<std::uint64_t> keys;
+    std::vector<size_t> indices;
+};
+
+inline std::vector<std::uint64_t> order_keys(std::span<const double> values, SortOrder order, ThreadPool& pool) {
+    std::vector<std::uint64_t> keys(values.size());
+    Blocks blocks = split(values.size(), pool);
+    pool.parallel_for(blocks.count, [&](size_t block) {
+        for (size_t i = blocks.begin(block); i < blocks.end(block, values.size()); ++i) {
+            keys[i] = order_key(values[i], order);
+        }
+    });
+    return keys;
+}
+
+inline RankedKeys rank_keys(std::span<const double> values, SortOrder order, ThreadPool& pool) {
+    RankedKeys ranked;
+    ranked.keys = order_keys(values, order, pool);
+    ranked.indices.resize(values.size());
+    std::iota(ranked.indices.begin(), ranked.indices.end(), size_t(0));
+    return ranked;
+}
+
+template<class Bucket>
+std::vector<size_t> histograms(const std::vector<std::uint64_t>& keys, size_t buckets, Bucket& bucket,
+                               Blocks blocks, ThreadPool& pool) {
+    std::vector<size_t> counts(blocks.count * buckets, 0);
+    pool.parallel_for(blocks.count, [&](size_t block) {
+        size_t* local = counts.data() + block * buckets;
+        for (size_t i = blocks.begin(block); i < blocks.end(block, keys.size()); ++i) {
+            ++local[bucket(keys[i])];
+        }
+    });
+    return counts;
+}
+
+template<class Bucket>
+void scatter(RankedKeys& ranked, RankedKeys& scratch, std::vector<size_t>& offsets, size_t buckets, Bucket& bucket,
+             Blocks blocks, ThreadPool& pool) {
+    size_t running = 0;
+    for (size_t digit = 0; digit < buckets; ++digit) {
+        for (size_t block = 0; block < blocks.count; ++block) {
+            size_t count = offsets[block * buckets + digit];
+            offsets[block * buckets + digit] = running;
+            running += count;
+        }
+    }
+    
+    scratch.keys.resize(ranked.keys.size());
+    scratch.indices.resize(ranked.indices.size());
+    pool.parallel_for(blocks.count, [&](size_t block) {
+        size_t* local = offsets.data() + block * buckets;
+        for (size_t i = blocks.begin(block); i < blocks.end(block, ranked.keys.size()); ++i) {
+            size_t target = local[bucket(ranked.keys[i])]++;
+            scratch.keys[target] = ranked.keys[i];
+            scratch.indices[target] = ranked.indices[i];
+        }
+    });
+    std::swap(ranked, scratch);
+}
+
+inline void radix_sort(RankedKeys& ranked, ThreadPool& pool) {
+    Blocks blocks = split(ranked.keys.size(), pool);
+    RankedKeys scratch;
+    for (size_t shift = 0; shift < 64; shift += radix_bits) {
+        auto digit = [shift](std::uint64_t key) { return static_cast<size_t>((key >> shift) & (radix_buckets - 1)); };
+        std::vector<size_t> counts = histograms(ranked.keys, radix_buckets, digit, blocks, pool);
+        
+        bool constant = false;
+        for (size_t d = 0; d < radix_buckets && !constant; ++d) {
+            size_t total = 0;
+            for (size_t block = 0; block < blocks.count; ++block) {
+                total += counts[block * radix_buckets + d];
+            }
+            constant = total == ranked.keys.size();
+        }
+        if (!constant) {
+            scatter(ranked, scratch, counts, radix_buckets, digit, blocks, pool);
+        }
+    }
+}
+
+inline std::uint64_t radix_select(const std::vector<std::uint64_t>& keys, size_t n, ThreadPool& pool) {
+    std::vector<std::uint64_t> candidates;
+    const std::vector<std::uint64_t>* current = &keys;
+    std::uint64_t prefix = 0;
+    for (size_t shift = 64; shift > 0;) {
+        shift -= radix_bits;
+        Blocks blocks = split(current->size(), pool);
+        auto digit = [shift](std::uint64_t key) { return static_cast<size_t>((key >> shift) & (radix_buckets - 1)); };
+        std::vector<size_t> counts = histograms(*current, radix_buckets, digit, blocks, pool);
+        
+        size_t selected = 0;
+        size_t selected_count = 0;
+        for (size_t d = 0; d < radix_buckets; ++d) {
+            size_t total = 0;
+            for (size_t block = 0; block < blocks.count; ++block) {
+                total += counts[block * radix_buckets + d];
+            }
+            if (n < total) {
+                selected = d;
+                selected_count = total;
+                break;
+            }
+            n -= total;
+        }
+        prefix |= static_cast<std::uint64_t>(selected) << shift;
+        
+        if (selected_count < current->size()) {
+            std::vector<std::uint64_t> next;
+            next.reserve(selected_count);
+            for (std::uint64_t key : *current) {
+                if (digit(key) == selected) {
+                    next.push_back(key);
+                }
+            }
+            candidates = std::move(next);
+            current = &candidates;
+        }
+    }
+    return prefix;
+}
+
+inline void partition_around(RankedKeys& ranked, size_t n, ThreadPool& pool) {
+    std::uint64_t pivot = radix_select(ranked.keys, n, pool);
+    auto side = [pivot](std::uint64_t key) { return key < pivot ? size_t(0) : (key == pivot ? size_t(1) : size_t(2)); };
+    Blocks blocks = split(ranked.keys.size(), pool);
+    std::vector<size_t> counts = histograms(ranked.keys, 3, side, blocks, pool);
+    RankedKeys scratch;
+    scatter(ranked, scratch, counts, 3, side, blocks, pool);
+}
+
+template<class Item, class... Policies>
+void permute(Array<Item, Policies...>& items, const std::vector<size_t>& order, ThreadPool& pool) {
+    std::vector<Item> gathered(order.size());
+    Blocks blocks = split(order.size(), pool);
+    pool.parallel_for(blocks.count, [&](size_t block) {
+        for (size_t i = blocks.begin(block); i < blocks.end(block, order.size()); ++i) {
+            gathered[i] = std::move(items[order[i]]);
+        }
+    });
+    pool.parallel_for(blocks.count, [&](size_t block) {
+        for (size_t i = blocks.begin(block); i < blocks.end(block, order.size()); ++i) {
+            items[i] = std::move(gathered[i]);
+        }
+    });
+}
+
+}
+
+template<Scalar T, class... Policies>
+std::vector<double> figure_keys(const Array<std::shared_ptr<Figure<T>>, Policies...>& figures, FigureKey key,
+                                ThreadPool& pool) {
+    std::vector<double> keys(figures.size());
+    figure_ranking_detail::Blocks blocks = figure_ranking_detail::split(figures.size(), pool);
+    pool.parallel_for(blocks.count, [&](size_t block) {
+        for (size_t i = blocks.begin(block); i < blocks.end(block, figures.size()); ++i) {
+            const Figure<T>& figure = *figures[i];
+            switch (key) {
+                case FigureKey::Area:
+                    keys[i] = figure.area();
+                    break;
+                case FigureKey::CenterX:
+                    keys[i] = static_cast<double>(figure.center().x());
+                    break;
+                case FigureKey::CenterY:
+                    keys[i] = static_cast<double>(figure.center().y());
+                    break;
+            }
+        }
+    });
+    return keys;
+}
+
+template<Scalar T>
+std::vector<double> figure_keys(const FigureStore<T>& store, FigureKey key, ThreadPool& pool) {
+    std::vector<double> keys(store.size());
+    QuadColumns<T> columns = store.columns();
+    figure_ranking_detail::Blocks blocks = figure_ranking_detail::split(store.size(), pool);
+    pool.parallel_for(blocks.count, [&](size_t block) {
+        size_t begin = blocks.begin(block);
+        QuadColumns<T> slice = columns.slice(begin, blocks.end(block, store.size()) - begin);
+        if (key == FigureKey::Area) {
+            batch_areas(slice, keys.data() + begin);
+            return;
+        }
+        
+        std::vector<T> center_x(slice.count);
+        std::vector<T> center_y(slice.count);
+        batch_centers(slice, center_x.data(), center_y.data());
+        const std::vector<T>& source = key == FigureKey::CenterX ? center_x : center_y;
+        for (size_t i = 0; i < slice.count; ++i) {
+            keys[begin + i] = static_cast<double>(source[i]);
+        }
+    });
+    return keys;
+}
+
+inline std::vector<size_t> sorted_order(std::span<const double> keys, ThreadPool& pool,
+                                        SortOrder order = SortOrder::Ascending) {
+    figure_ranking_detail::RankedKeys ranked = figure_ranking_detail::rank_keys(keys, order, pool);
+    figure_ranking_detail::radix_sort(ranked, pool);
+    return std::move(ranked.indices);
+}
+
+inline std::vector<size_t> nth_order(std::span<const double> keys, size_t n, ThreadPool& pool,
+                                     SortOrder order = SortOrder::Ascending) {
+    if (n >= keys.size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    figure_ranking_detail::RankedKeys ranked = figure_ranking_detail::rank_keys(keys, order, pool);
+    figure_ranking_detail::partition_around(ranked, n, pool);
+    return std::move(ranked.indices);
+}
+
+inline std::vector<size_t> top_k_order(std::span<const double> keys, size_t k, ThreadPool& pool,
+                                       SortOrder order = SortOrder::Descending) {
+    k = std::min(k, keys.size());
+    if (k == 0) {
+        return {};
+    }
+    
+    std::vector<std::uint64_t> ordered = figure_ranking_detail::order_keys(keys, order, pool);
+    std::uint64_t pivot = figure_ranking_detail::radix_select(ordered, k - 1, pool);
+    figure_ranking_detail::RankedKeys top;
+    top.keys.reserve(k);
+    top.indices.reserve(k);
+    size_t ties = k;
+    for (std::uint64_t key : ordered) {
+        ties -= key < pivot;
+    }
+    for (size_t i = 0; i < ordered.size() && top.keys.size() < k; ++i) {
+        std::uint64_t key = ordered[i];
+        if (key < pivot || (key == pivot && ties > 0)) {
+            ties -= key == pivot;
+            top.keys.push_back(key);
+            top.indices.push_back(i);
+        }
+    }
+    figure_ranking_detail::radix_sort(top, pool);
+    return std::move(top.indices);
+}
+
+template<Scalar T, class... Policies>
+void sort_figures(Array<std::shared_ptr<Figure<T>>, Policies...>& figures, FigureKey key, ThreadPool& pool,
+                  SortOrder order = SortOrder::Ascending) {
+    std::vector<double> keys = figure_keys(figures, key, pool);
+    figure_ranking_detail::permute(figures, sorted_order(keys, pool, order), pool);
+}
+
+template<Scalar T, class... Policies>
+void nth_figure(Array<std::shared_ptr<Figure<T>>, Policies...>& figures, size_t n, FigureKey key, ThreadPool& pool,
+                SortOrder order = SortOrder::Ascending) {
+    std::vector<double> keys = figure_keys(figures, key, pool);
+    figure_ranking_detail::permute(figures, nth_order(keys, n, pool, order), pool);
+}
+
+template<Scalar T, class... Policies>
+Array<std::shared_ptr<Figure<T>>, Policies...> top_k_figures(const Array<std::shared_ptr<Figure<T>>, Policies...>& figures,
+                                                             size_t k, FigureKey key, ThreadPool& pool,
+                                                             SortOrder order = SortOrder::Descending) {
+    std::vector<double> keys = figure_keys(figures, key, pool);
+    std::vector<size_t> top = top_k_order(keys, k, pool, order);
+    Array<std::shared_ptr<Figure<T>>, Policies...> result(top.size());
+    for (size_t index : top) {
+        result.push_back(figures[index]);
+    }
+    return result;
+}
@@ -0,0 +1,148 @@
+#pragma once
+#include "Point.h"
+#include "Figure.h"
+#include "Array.h"
+#include "FigureStore.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+class CompensatedSum {
+private:
+    double sum_ = 0.0;
+    double compensation_ = 0.0;
+
+public:
+    void add(double value) {
+        double total = sum_ + value;
+        if (std::abs(sum_) >= std::abs(value)) {
+            compensation_ += (sum_ - total) + value;
+        } else {
+            compensation_ += (value - total) + sum_;
+        }
+        sum_ = total;
+    }
+    
+    void add(const CompensatedSum& other) {
+        add(other.sum_);
+        add(other.compensation_);
+    }
+    
+    double value() const {
+        return sum_ + compensation_;
+    }
+};
+
+struct FigureStats {
+    size_t count = 0;
+    double total_area = 0.0;
+    double min_area = 0.0;
+    double max_area = 0.0;
+    double mean_area = 0.0;
+    Point<double> centroid;
+};
+
+class FigureStatsAccumulator {
+private:
+    size_t count_ = 0;
+    CompensatedSum area_;
+    CompensatedSum moment_x_;
+    CompensatedSum moment_y_;
+    double min_area_ = std::numeric_limits<double>::infinity();
+    double max_area_ = -std::numeric_limits<double>::infinity();
+
+public:
+    void add(double area, double center_x, double center_y) {
+        ++count_;
+        area_.add(area);
+        moment_x_.add(area * center_x);
+        moment_y_.add(area * center_y);
+        min_area_ = std::min(min_area_, area);
+        max_area_ = std::max(max_area_, area);
+    }
+    
+    void merge(const FigureStatsAccumulator& other) {
+        count_ += other.count_;
+        area_.add(other.area_);
+        moment_x_.add(other.moment_x_);
+        moment_y_.add(other.moment_y_);
+        min_area_ = std::min(min_area_, other.min_area_);
+        max_area_ = std::max(max_area_, other.max_area_);
+    }
+    
+    FigureStats result() const {
+        FigureStats stats;
+        stats.count = count_;
+        if (count_ == 0) {
+            return stats;
+        }
+        
+        stats.total_area = area_.value();
+        stats.min_area = min_area_;
+        stats.max_area = max_area_;
+        stats.mean_area = stats.total_area / static_cast<double>(count_);
+        if (stats.total_area != 0.0) {
+            stats.centroid = Point<double>(moment_x_.value() / stats.total_area, 
+                                           moment_y_.value() / stats.total_area);
+        }
+        return stats;
+    }
+};
+
+constexpr size_t default_stats_block_size = 4096;
+
+template<class BlockFunction>
+FigureStats reduce_figure_blocks(size_t count, size_t block_size, ThreadPool& pool, BlockFunction&& block_function) {
+    block_size = std::max<size_t>(1, block_size);
+    size_t blocks = (count + block_size - 1) / block_size;
+    std::vector<FigureStatsAccumulator> partials(blocks);
+    
+    pool.parallel_for(blocks, [&](size_t block) {
+        size_t begin = block * block_size;
+        size_t end = std::min(count, begin + block_size);
+        block_function(begin, end, partials[block]);
+    });
+    
+    FigureStatsAccumulator total;
+    for (const auto& partial : partials) {
+        total.merge(partial);
+    }
+    return total.result();
+}
+
+template<Scalar T, class... Policies>
+FigureStats figure_stats(const Array<std::shared_ptr<Figure<T>>, Policies...>& figures, ThreadPool& pool, 
+                         size_t block_size = default_stats_block_size) {
+    return reduce_figure_blocks(figures.size(), block_size, pool, 
+        [&figures](size_t begin, size_t end, FigureStatsAccumulator& partial) {
+            for (size_t i = begin; i < end; ++i) {
+                const Figure<T>& figure = *figures.at(i);
+                Point<T> center = figure.center();
+                partial.add(figure.area(), static_cast<double>(center.x()), static_cast<double>(center.y()));
+            }
+        });
+}
+
+template<Scalar T>
+FigureStats figure_stats(const FigureStore<T>& store, ThreadPool& pool, 
+                         size_t block_size = default_stats_block_size) {
+    QuadColumns<T> columns = store.columns();
+    return reduce_figure_blocks(store.size(), block_size, pool, 
+        [&columns](size_t begin, size_t end, FigureStatsAccumulator& partial) {
+            QuadColumns<T> slice = columns.slice(begin, end - begin);
+            
+            std::vector<double> areas(slice.count);
+            std::vector<T> center_x(slice.count);
+            std::vector<T> center_y(slice.count);
+            batch_areas(slice, areas.data());
+            batch_centers(slice, center_x.data(), center_y.data());
+            
+            for (size_t i = 0; i < slice.count; ++i) {
+                partial.add(areas[i], static_cast<double>(center_x[i]), static_cast<double>(center_y[i]));
+            }
+        });
+}
@@ -0,0 +1,344 @@
+#pragma once
+#include "Point.h"
+#include "BoundingBox.h"
+#include "Figure.h"
+#include "Rectangle.h"
+#include "Trapezoid.h"
+#include "Rhombus.h"
+#include "Array.h"
+#include "FigureKind.h"
+#include "SimdKernels.h"
+#include <array>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <iostream>
+
+template<Scalar T>
+class FigureStore {
+public:
+    static constexpr size_t vertices_per_figure = 4;
+
+private:
+    std::vector<FigureKind> kinds_;
+    std::array<std::vector<T>, vertices_per_figure> xs_;
+    std::array<std::vector<T>, vertices_per_figure> ys_;
+    
+    void push_vertices(FigureKind kind, const Figure<T>& figure) {
+        if (figure.vertex_count() != vertices_per_figure) {
+            throw std::invalid_argument("Figure must have exactly four vertices");
+        }
+        
+        kinds_.push_back(kind);
+        for (size_t k = 0; k < vertices_per_figure; ++k) {
+            const Point<T>& vertex = figure.get_vertex(k);
+            xs_[k].push_back(vertex.x());
+            ys_[k].push_back(vertex.y());
+        }
+    }
+    
+    void push_vertices(FigureKind kind, const typename QuadValue<T>::Vertices& vertices) {
+        kinds_.push_back(kind);
+        for (size_t k = 0; k < vertices_per_figure; ++k) {
+            xs_[k].push_back(vertices[k].x());
+            ys_[k].push_back(vertices[k].y());
+        }
+    }
+    
+    void check_index(size_t index) const {
+        if (index >= kinds_.size()) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+    
+    Point<T> point(size_t index, size_t k) const {
+        return Point<T>(xs_[k][index], ys_[k][index]);
+    }
+    
+    double area_unchecked(size_t index) const {
+        return simd_detail::quad_area(columns(), index);
+    }
+    
+    BoundingBox<T> bounding_box_unchecked(size_t index) const {
+        BoundingBox<T> box(point(index, 0));
+        for (size_t k = 1; k < vertices_per_figure; ++k) {
+            box.expand(point(index, k));
+        }
+        return box;
+    }
+    
+    Point<T> center_unchecked(size_t index) const {
+        T sum_x = T{};
+        T sum_y = T{};
+        
+        for (size_t k = 0; k < vertices_per_figure; ++k) {
+            sum_x += xs_[k][index];
+            sum_y += ys_[k][index];
+        }
+        
+        return Point<T>(sum_x / static_cast<T>(vertices_per_figure),
+                       sum_y / static_cast<T>(vertices_per_figure));
+    }
+
+public:
+    class FigureRef {
+    private:
+        const FigureStore* store_;
+        size_t index_;
+        
+    public:
+        FigureRef(const FigureStore* store, size_t index) : store_(store), index_(index) {}
+        
+        size_t index() const { return index_; }
+        FigureKind kind() const { return store_->kinds_[index_]; }
+        
+        Point<T> get_vertex(size_t k) const {
+            if (k >= vertices_per_figure) {
+                throw std::out_of_range("Index out of range");
+            }
+            return store_->point(index_, k);
+        }
+        
+        size_t vertex_count() const { return vertices_per_figure; }
+        
+        double area() const { return store_->area_unchecked(index_); }
+        Point<T> center() const { return store_->center_unchecked(index_); }
+        BoundingBox<T> bounding_box() const { return store_->bounding_box_unchecked(index_); }
+        
+        friend std::ostream& operator<<(std::ostream& os, const FigureRef& ref) {
+            os << "Center: " << ref.center() << ", Area: " << ref.area() << ", Vertices: ";
+            for (size_t k = 0; k < vertices_per_figure; ++k) {
+                os << "Vertex " << k + 1 << ": " << ref.get_vertex(k);
+                if (k < vertices_per_figure - 1) {
+                    os << ", ";
+                }
+            }
+            return os;
+        }
+    };
+    
+    class const_iterator {
+    private:
+        const FigureStore* store_;
+        size_t index_;
+        
+    public:
+        const_iterator(const FigureStore* store, size_t index) : store_(store), index_(index) {}
+        
+        FigureRef operator*() const { return FigureRef(store_, index_); }
+        
+        const_iterator& operator++() {
+            ++index_;
+            return *this;
+        }
+        
+        const_iterator operator++(int) {
+            const_iterator temp = *this;
+            ++index_;
+            return temp;
+        }
+        
+        bool operator==(const const_iterator& other) const {
+            return store_ == other.store_ && index_ == other.index_;
+        }
+        
+        bool operator!=(const const_iterator& other) const {
+            return !(*this == other);
+        }
+    };
+    
+    FigureStore() = default;
+    
+    explicit FigureStore(const Array<std::shared_ptr<Figure<T>>>& figures) {
+        reserve(figures.size());
+        for (size_t i = 0; i < figures.size(); ++i) {
+            push_back(*figures[i]);
+        }
+    }
+    
+    void reserve(size_t count) {
+        kinds_.reserve(count);
+        for (size_t k = 0; k < vertices_per_figure; ++k) {
+            xs_[k].reserve(count);
+            ys_[k].reserve(count);
+        }
+    }
+    
+    void push_back(const Rectangle<T>& rectangle) {
+        push_vertices(FigureKind::Rectangle, rectangle);
+    }
+    
+    void push_back(const Trapezoid<T>& trapezoid) {
+        push_vertices(FigureKind::Trapezoid, trapezoid);
+    }
+    
+    void push_back(const Rhombus<T>& rhombus) {
+        push_vertices(FigureKind::Rhombus, rhombus);
+    }
+    
+    void push_back(const RectangleValue<T>& rectangle) {
+        push_vertices(FigureKind::Rectangle, rectangle.vertices());
+    }
+    
+    void push_back(const TrapezoidValue<T>& trapezoid) {
+        push_vertices(FigureKind::Trapezoid, trapezoid.vertices());
+    }
+    
+    void push_back(const RhombusValue<T>& rhombus) {
+        push_vertices(FigureKind::Rhombus, rhombus.vertices());
+    }
+    
+    void push_back(const Figure<T>& figure) {
+        if (auto rectangle = dynamic_cast<const Rectangle<T>*>(&figure)) {
+            push_back(*rectangle);
+        } else if (auto trapezoid = dynamic_cast<const Trapezoid<T>*>(&figure)) {
+            push_back(*trapezoid);
+        } else if (auto rhombus = dynamic_cast<const Rhombus<T>*>(&figure)) {
+            push_back(*rhombus);
+        } else {
+            throw std::invalid_argument("Unsupported figure type");
+        }
+    }
+    
+    size_t size() const {
+        return kinds_.size();
+    }
+    
+    bool empty() const {
+        return kinds_.empty();
+    }
+    
+    void clear() {
+        kinds_.clear();
+        for (size_t k = 0; k < vertices_per_figure; ++k) {
+            xs_[k].clear();
+            ys_[k].clear();
+        }
+    }
+    
+    FigureRef operator[](size_t index) const {
+        check_index(index);
+        return FigureRef(this, index);
+    }
+    
+    FigureKind kind(size_t index) const {
+        check_index(index);
+        return kinds_[index];
+    }
+    
+    Point<T> get_vertex(size_t index, size_t k) const {
+        return (*this)[index].get_vertex(k);
+    }
+    
+    double area(size_t index) const {
+        check_index(index);
+        return area_unchecked(index);
+    }
+    
+    Point<T> center(size_t index) const {
+        check_index(index);
+        return center_unchecked(index);
+    }
+    
+    BoundingBox<T> bounding_box(size_t index) const {
+        check_index(index);
+        return bounding_box_unchecked(index);
+    }
+    
+    QuadColumns<T> columns() const {
+        QuadColumns<T> result;
+        result.kinds = kinds_.data();
+        for (size_t k = 0; k < vertices_per_figure; ++k) {
+            result.x[k] = xs_[k].data();
+            result.y[k] = ys_[k].data();
+        }
+        result.count = kinds_.size();
+        return result;
+    }
+    
+    void areas(double* out) const {
+        batch_areas(columns(), out);
+    }
+    
+    std::vector<double> areas() const {
+        std::vector<double> result(kinds_.size());
+        areas(result.data());
+        return result;
+    }
+    
+    void centers(T* center_x, T* center_y) const {
+        batch_centers(columns(), center_x, center_y);
+    }
+    
+    std::vector<Point<T>> centers() const {
+        std::vector<T> center_x(kinds_.size());
+        std::vector<T> center_y(kinds_.size());
+        centers(center_x.data(), center_y.data());
+        
+        std::vector<Point<T>> result;
+        result.reserve(kinds_.size());
+        for (size_t i = 0; i < kinds_.size(); ++i) {
+            result.emplace_back(center_x[i], center_y[i]);
+        }
+        return result;
+    }
+    
+    double total_area() const {
+        return batch_total_area(columns());
+    }
+    
+    const FigureKind* kind_data() const {
+        return kinds_.data();
+    }
+    
+    const T* x_data(size_t k) const {
+        return xs_.at(k).data();
+    }
+    
+    const T* y_data(size_t k) const {
+        return ys_.at(k).data();
+    }
+    
+    T* x_data(size_t k) {
+        return xs_.at(k).data();
+    }
+    
+    T* y_data(size_t k) {
+        return ys_.at(k).data();
+    }
+    
+    std::shared_ptr<Figure<T>> make_figure(size_t index) const {
+        check_index(index);
+        
+        typename QuadValue<T>::Vertices vertices;
+        for (size_t k = 0; k < vertices_per_figure; ++k) {
+            vertices[k] = point(index, k);
+        }
+        
+        switch (kinds_[index]) {
+            case FigureKind::Rectangle:
+                return std::make_shared<Rectangle<T>>(RectangleValue<T>::from_validated(vertices));
+            case FigureKind::Trapezoid:
+                return std::make_shared<Trapezoid<T>>(TrapezoidValue<T>::from_validated(vertices));
+            case FigureKind::Rhombus:
+                return std::make_shared<Rhombus<T>>(RhombusValue<T>::from_validated(vertices));
+        }
+        throw std::invalid_argument("Unsupported figure type");
+    }
+    
+    Array<std::shared_ptr<Figure<T>>> to_array() const {
+        Array<std::shared_ptr<Figure<T>>> result(kinds_.size());
+        for (size_t i = 0; i < kinds_.size(); ++i) {
+            result.push_back(make_figure(i));
+        }
+        return result;
+    }
+    
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+    
+    const_iterator end() const {
+        return const_iterator(this, kinds_.size());
+    }
+};
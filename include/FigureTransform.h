@@ -0,0 +1,152 @@
+#pragma once
+#include "AffineTransform.h"
+#include "Figure.h"
+#include "Array.h"
+#include "FigureStore.h"
+#include "FigureBatch.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include "ValidityBitmap.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <memory>
+
+constexpr size_t default_transform_block_size = 4096;
+
+namespace figure_transform_detail {
+
+constexpr size_t word_bits = ValidityBitmap::bits_per_word;
+
+template<class RangeFunction>
+void for_each_range(size_t count, size_t block_size, ThreadPool& pool, RangeFunction&& range_function) {
+    block_size = std::max<size_t>(1, (block_size + word_bits - 1) / word_bits) * word_bits;
+    size_t blocks = (count + block_size - 1) / block_size;
+    
+    pool.parallel_for(blocks, [&](size_t block) {
+        size_t begin = block * block_size;
+        range_function(begin, std::min(count, begin + block_size));
+    });
+}
+
+template<Scalar T>
+std::uint64_t representable_word(const FigureStore<T>& store, const AffineTransform& transform, size_t first,
+                                 size_t count) {
+    std::uint64_t bits = 0;
+    for (size_t i = 0; i < count; ++i) {
+        bool fits = true;
+        for (size_t k = 0; k < 4 && fits; ++k) {
+            fits = transform.fits(Point<T>(store.x_data(k)[first + i], store.y_data(k)[first + i]));
+        }
+        bits |= static_cast<std::uint64_t>(fits) << i;
+    }
+    return bits;
+}
+
+template<Scalar T>
+void transform_store_range(FigureStore<T>& store, const AffineTransform& transform, size_t begin, size_t end,
+                           ValidityBitmap& valid, SimdLevel level) {
+    constexpr size_t block = figure_batch_detail::block_size;
+    T xs[4][block];
+    T ys[4][block];
+    std::array<T*, 4> target_x;
+    std::array<T*, 4> target_y;
+    
+    QuadColumns<T> columns;
+    for (size_t k = 0; k < 4; ++k) {
+        columns.x[k] = xs[k];
+        columns.y[k] = ys[k];
+        target_x[k] = store.x_data(k);
+        target_y[k] = store.y_data(k);
+    }
+    
+    for (size_t first = begin; first < end; first += block) {
+        columns.kinds = store.kind_data() + first;
+        columns.count = std::min(block, end - first);
+        for (size_t k = 0; k < 4; ++k) {
+            std::copy_n(target_x[k] + first, columns.count, xs[k]);
+            std::copy_n(target_y[k] + first, columns.count, ys[k]);
+            batch_affine(xs[k], ys[k], columns.count, transform, level);
+        }
+        
+        for (size_t offset = 0; offset < columns.count; offset += word_bits) {
+            size_t count = std::min(word_bits, columns.count - offset);
+            std::uint64_t bits = figure_batch_detail::validate_word(columns, offset, count, level);
+            if constexpr (IntegralScalar<T>) {
+                bits &= representable_word(store, transform, first + offset, count);
+            }
+            valid.set_word((first + offset) / word_bits, bits);
+            
+            std::uint64_t full = count == word_bits ? ~std::uint64_t(0) : (std::uint64_t(1) << count) - 1;
+            if (bits == full) {
+                for (size_t k = 0; k < 4; ++k) {
+                    std::copy_n(xs[k] + offset, count, target_x[k] + first + offset);
+                    std::copy_n(ys[k] + offset, count, target_y[k] + first + offset);
+                }
+                continue;
+            }
+            for (; bits != 0; bits &= bits - 1) {
+                size_t i = offset + static_cast<size_t>(std::countr_zero(bits));
+                for (size_t k = 0; k < 4; ++k) {
+                    target_x[k][first + i] = xs[k][i];
+                    target_y[k][first + i] = ys[k][i];
+                }
+            }
+        }
+    }
+}
+
+template<Scalar T, class... Policies>
+void transform_array_range(Array<std::shared_ptr<Figure<T>>, Policies...>& figures, const AffineTransform& transform,
+                           size_t begin, size_t end, ValidityBitmap& valid) {
+    for (size_t first = begin; first < end; first += word_bits) {
+        size_t count = std::min(word_bits, end - first);
+        std::uint64_t bits = 0;
+        for (size_t i = 0; i < count; ++i) {
+            bits |= static_cast<std::uint64_t>(figures[first + i]->try_transform(transform)) << i;
+        }
+        valid.set_word(first / word_bits, bits);
+    }
+}
+
+}
+
+template<Scalar T>
+ValidityBitmap transform_figures(FigureStore<T>& store, const AffineTransform& transform,
+                                 SimdLevel level = detected_simd_level()) {
+    level = std::min(level, detected_simd_level());
+    ValidityBitmap valid(store.size());
+    figure_transform_detail::transform_store_range(store, transform, 0, store.size(), valid, level);
+    return valid;
+}
+
+template<Scalar T>
+ValidityBitmap transform_figures(FigureStore<T>& store, const AffineTransform& transform, ThreadPool& pool,
+                                 size_t block_size = default_transform_block_size) {
+    SimdLevel level = detected_simd_level();
+    ValidityBitmap valid(store.size());
+    figure_transform_detail::for_each_range(store.size(), block_size, pool, [&](size_t begin, size_t end) {
+        figure_transform_detail::transform_store_range(store, transform, begin, end, valid, level);
+    });
+    return valid;
+}
+
+template<Scalar T, class... Policies>
+ValidityBitmap transform_figures(Array<std::shared_ptr<Figure<T>>, Policies...>& figures,
+                                 const AffineTransform& transform) {
+    ValidityBitmap valid(figures.size());
+    figure_transform_detail::transform_array_range(figures, transform, 0, figures.size(), valid);
+    return valid;
+}
+
+template<Scalar T, class... Policies>
+ValidityBitmap transform_figures(Array<std::shared_ptr<Figure<T>>, Policies...>& figures,
+                                 const AffineTransform& transform, ThreadPool& pool,
+                                 size_t block_size = default_transform_block_size) {
+    ValidityBitmap valid(figures.size());
+    figure_transform_detail::for_each_range(figures.size(), block_size, pool, [&](size_t begin, size_t end) {
+        figure_transform_detail::transform_array_range(figures, transform, begin, end, valid);
+    });
+    return valid;
+}
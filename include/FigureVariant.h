@@ -0,0 +1,183 @@
+#pragma once
+#include "Point.h"
+#include "Figure.h"
+#include "Rectangle.h"
+#include "Trapezoid.h"
+#include "Rhombus.h"
+#include "Array.h"
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <variant>
+#include <stdexcept>
+#include <iostream>
+
+template<Scalar T>
+class FigureVariant {
+public:
+    using variant_type = std::variant<Rectangle<T>, Trapezoid<T>, Rhombus<T>>;
+
+private:
+    variant_type figure_;
+    
+    template<class Visitor>
+    decltype(auto) visit(Visitor&& visitor) const {
+        return std::visit(std::forward<Visitor>(visitor), figure_);
+    }
+    
+    std::span<const Point<T>> points() const {
+        return visit([](const auto& shape) {
+            using Shape = std::remove_cvref_t<decltype(shape)>;
+            return shape.Shape::vertices();
+        });
+    }
+
+public:
+    FigureVariant() = default;
+    
+    template<class Shape>
+        requires std::is_constructible_v<variant_type, Shape&&> && 
+                 (!std::is_same_v<std::remove_cvref_t<Shape>, FigureVariant>)
+    FigureVariant(Shape&& shape) : figure_(std::forward<Shape>(shape)) {}
+    
+    static FigureVariant from_figure(const Figure<T>& figure) {
+        if (auto rectangle = dynamic_cast<const Rectangle<T>*>(&figure)) {
+            return FigureVariant(*rectangle);
+        }
+        if (auto trapezoid = dynamic_cast<const Trapezoid<T>*>(&figure)) {
+            return FigureVariant(*trapezoid);
+        }
+        if (auto rhombus = dynamic_cast<const Rhombus<T>*>(&figure)) {
+            return FigureVariant(*rhombus);
+        }
+        throw std::invalid_argument("Unsupported figure type");
+    }
+    
+    std::shared_ptr<Figure<T>> to_figure() const {
+        return visit([](const auto& shape) -> std::shared_ptr<Figure<T>> {
+            using Shape = std::remove_cvref_t<decltype(shape)>;
+            return std::make_shared<Shape>(shape);
+        });
+    }
+    
+    size_t index() const {
+        return figure_.index();
+    }
+    
+    template<class Shape>
+    bool holds() const {
+        return std::holds_alternative<Shape>(figure_);
+    }
+    
+    template<class Shape>
+    const Shape& get() const {
+        return std::get<Shape>(figure_);
+    }
+    
+    const variant_type& variant() const {
+        return figure_;
+    }
+    
+    double area() const {
+        return visit([](const auto& shape) {
+            return shape.value().area();
+        });
+    }
+    
+    Point<T> center() const {
+        std::span<const Point<T>> vertices = points();
+        if (vertices.empty()) {
+            return Point<T>();
+        }
+        
+        T sum_x = T{};
+        T sum_y = T{};
+        
+        for (const auto& vertex : vertices) {
+            sum_x += vertex.x();
+            sum_y += vertex.y();
+        }
+        
+        return Point<T>(sum_x / static_cast<T>(vertices.size()), 
+                       sum_y / static_cast<T>(vertices.size()));
+    }
+    
+    size_t vertex_count() const {
+        return points().size();
+    }
+    
+    const Point<T>& get_vertex(size_t index) const {
+        std::span<const Point<T>> vertices = points();
+        if (index >= vertices.size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        return vertices[index];
+    }
+    
+    explicit operator double() const {
+        return area();
+    }
+    
+    bool operator==(const FigureVariant& other) const {
+        if (figure_.index() != other.figure_.index()) {
+            return false;
+        }
+        
+        std::span<const Point<T>> vertices = points();
+        std::span<const Point<T>> other_vertices = other.points();
+        if (vertices.size() != other_vertices.size()) {
+            return false;
+        }
+        
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            if (vertices[i] != other_vertices[i]) {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    bool operator!=(const FigureVariant& other) const {
+        return !(*this == other);
+    }
+    
+    friend std::ostream& operator<<(std::ostream& os, const FigureVariant& figure) {
+        os << "Center: " << figure.center() << ", Area: " << figure.area() << ", Vertices: ";
+        std::span<const Point<T>> vertices = figure.points();
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            os << "Vertex " << i + 1 << ": " << vertices[i];
+            if (i < vertices.size() - 1) {
+                os << ", ";
+            }
+        }
+        return os;
+    }
+};
+
+template<Scalar T>
+Array<FigureVariant<T>> to_variant_array(const Array<std::shared_ptr<Figure<T>>>& figures) {
+    Array<FigureVariant<T>> result(figures.size());
+    for (size_t i = 0; i < figures.size(); ++i) {
+        result.push_back(FigureVariant<T>::from_figure(*figures[i]));
+    }
+    return result;
+}
+
+template<Scalar T>
+Array<std::shared_ptr<Figure<T>>> to_figure_array(const Array<FigureVariant<T>>& figures) {
+    Array<std::shared_ptr<Figure<T>>> result(figures.size());
+    for (size_t i = 0; i < figures.size(); ++i) {
+        result.push_back(figures[i].to_figure());
+    }
+    return result;
+}
+
+template<Scalar T>
+double total_area(const Array<FigureVariant<T>>& figures) {
+    double total = 0.0;
+    for (size_t i = 0; i < figures.size(); ++i) {
+        total += figures[i].area();
+    }
+    return total;
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include "Figure.h"
+#include "Array.h"
+#include "FigureStore.h"
+#include "FigureFormatter.h"
+#include <cerrno>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+template<Scalar T>
+class FigureWriter {
+public:
+    static constexpr size_t default_flush_threshold = size_t(1) << 20;
+
+private:
+    int fd_;
+    FigureFormatter<T> formatter_;
+    size_t flush_threshold_;
+    std::string buffer_;
+    size_t bytes_written_ = 0;
+    
+    void flush_if_full() {
+        if (buffer_.size() >= flush_threshold_) {
+            flush();
+        }
+    }
+
+public:
+    explicit FigureWriter(int fd, FigureFormat format = FigureFormat::Human, 
+                          size_t flush_threshold = default_flush_threshold) 
+        : fd_(fd), formatter_(format), flush_threshold_(flush_threshold) {
+        buffer_.reserve(flush_threshold + flush_threshold / 4);
+        formatter_.append_header(buffer_);
+    }
+    
+    FigureWriter(const FigureWriter& other) = delete;
+    
+    FigureWriter& operator=(const FigureWriter& other) = delete;
+    
+    ~FigureWriter() {
+        try {
+            flush();
+        } catch (...) {
+        }
+    }
+    
+    void write(const Figure<T>& figure) {
+        formatter_.append(buffer_, figure);
+        if (formatter_.format() == FigureFormat::Human) {
+            buffer_ += '\n';
+        }
+        flush_if_full();
+    }
+    
+    template<class... Policies>
+    void write(const Array<std::shared_ptr<Figure<T>>, Policies...>& figures) {
+        if (formatter_.format() == FigureFormat::Human) {
+            buffer_ += '[';
+            for (size_t i = 0; i < figures.size(); ++i) {
+                formatter_.append(buffer_, *figures[i]);
+                if (i < figures.size() - 1) {
+                    buffer_ += ", ";
+                }
+                flush_if_full();
+            }
+            buffer_ += "]\n";
+            flush_if_full();
+            return;
+        }
+        for (size_t i = 0; i < figures.size(); ++i) {
+            write(*figures[i]);
+        }
+    }
+    
+    void write(const FigureStore<T>& store) {
+        for (auto figure : store) {
+            formatter_.append(buffer_, figure);
+            if (formatter_.format() == FigureFormat::Human) {
+                buffer_ += '\n';
+            }
+            flush_if_full();
+        }
+    }
+    
+    void flush() {
+        size_t offset = 0;
+        while (offset < buffer_.size()) {
+            ssize_t written = ::write(fd_, buffer_.data() + offset, buffer_.size() - offset);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                buffer_.erase(0, offset);
+                throw std::runtime_error("Failed to write figure output");
+            }
+            offset += static_cast<size_t>(written);
+            bytes_written_ += static_cast<size_t>(written);
+        }
+        buffer_.clear();
+    }
+    
+    size_t bytes_written() const {
+        return bytes_written_;
+    }
+    
+    size_t buffered() const {
+        return buffer_.size();
+    }
+};
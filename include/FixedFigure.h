@@ -0,0 +1,64 @@
+#pragma once
+#include "Figure.h"
+#include "AffineTransform.h"
+#include <algorithm>
+#include <array>
+#include <span>
+#include <stdexcept>
+
+template<Scalar T, size_t N>
+class FixedFigure : public Figure<T> {
+protected:
+    std::array<Point<T>, N> vertices_;
+    size_t count_ = 0;
+    
+    void add_vertex(T x, T y) {
+        if (count_ >= N) {
+            throw std::length_error("Vertex capacity exceeded");
+        }
+        vertices_[count_++] = Point<T>(x, y);
+        this->invalidate_cache();
+    }
+    
+    virtual bool has_valid_shape() const {
+        return true;
+    }
+
+public:
+    static constexpr size_t capacity = N;
+    
+    FixedFigure() = default;
+    
+    FixedFigure(const FixedFigure& other) = default;
+    
+    FixedFigure(FixedFigure&& other) noexcept = default;
+    
+    FixedFigure& operator=(const FixedFigure& other) = default;
+    
+    FixedFigure& operator=(FixedFigure&& other) noexcept = default;
+    
+    std::span<const Point<T>> vertices() const override {
+        return std::span<const Point<T>>(vertices_.data(), count_);
+    }
+    
+    bool try_transform(const AffineTransform& transform) override {
+        for (size_t i = 0; i < count_; ++i) {
+            if (!transform.fits(vertices_[i])) {
+                return false;
+            }
+        }
+        
+        std::array<Point<T>, N> original;
+        std::copy_n(vertices_.begin(), count_, original.begin());
+        for (size_t i = 0; i < count_; ++i) {
+            vertices_[i] = transform.apply(vertices_[i]);
+        }
+        
+        if (!has_valid_shape()) {
+            std::copy_n(original.begin(), count_, vertices_.begin());
+            return false;
+        }
+        this->invalidate_cache();
+        return true;
+    }
+};
@@ -0,0 +1,286 @@
+#pragma once
+#include "Point.h"
+#include "Figure.h"
+#include "BoundingBox.h"
+#include "FigureKind.h"
+#include "FigureFile.h"
+#include "FigureStore.h"
+#include "SimdKernels.h"
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+template<Scalar T>
+class MappedFigureFile {
+public:
+    static constexpr size_t vertices_per_figure = 4;
+    static constexpr size_t validation_block = 4096;
+
+private:
+    const unsigned char* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    FigureFileHeader header_;
+    QuadColumns<T> columns_;
+    FigureFileValidation validation_ = FigureFileValidation::None;
+    std::unique_ptr<std::atomic<bool>[]> validated_blocks_;
+    
+    void unmap() {
+        if (mapping_ != nullptr) {
+            munmap(const_cast<unsigned char*>(mapping_), mapping_size_);
+            mapping_ = nullptr;
+            mapping_size_ = 0;
+        }
+    }
+    
+    void check_layout() const {
+        if (header_.scalar_type != figure_file_detail::scalar_type<T>()) {
+            throw std::runtime_error("Figure file scalar type does not match");
+        }
+        if (header_.vertices_per_figure != vertices_per_figure) {
+            throw std::runtime_error("Figure file vertex count does not match");
+        }
+        
+        std::uint64_t count = header_.count;
+        for (size_t c = 0; c < FigureFileHeader::column_count; ++c) {
+            std::uint64_t width = c == 0 ? 1 : sizeof(T);
+            std::uint64_t offset = header_.offsets[c];
+            if (offset % (c == 0 ? 1 : alignof(T)) != 0 || offset > mapping_size_ ||
+                count > (mapping_size_ - offset) / width) {
+                throw std::runtime_error("Figure file column out of bounds");
+            }
+        }
+    }
+    
+    void validate_range(size_t begin, size_t end) const {
+        for (size_t i = begin; i < end; ++i) {
+            if (static_cast<std::uint8_t>(columns_.kinds[i]) > static_cast<std::uint8_t>(FigureKind::Rhombus)) {
+                throw std::runtime_error("Corrupted figure kind at record " + std::to_string(i));
+            }
+            if constexpr (std::is_floating_point_v<T>) {
+                for (size_t k = 0; k < vertices_per_figure; ++k) {
+                    if (!std::isfinite(columns_.x[k][i]) || !std::isfinite(columns_.y[k][i])) {
+                        throw std::runtime_error("Non-finite coordinate at record " + std::to_string(i));
+                    }
+                }
+            }
+        }
+    }
+    
+    void ensure_valid(size_t index) const {
+        if (validation_ != FigureFileValidation::Lazy) {
+            return;
+        }
+        
+        size_t block = index / validation_block;
+        if (validated_blocks_[block].load(std::memory_order_acquire)) {
+            return;
+        }
+        
+        size_t begin = block * validation_block;
+        validate_range(begin, std::min(begin + validation_block, columns_.count));
+        validated_blocks_[block].store(true, std::memory_order_release);
+    }
+    
+    void ensure_all_valid() const {
+        if (validation_ != FigureFileValidation::Lazy) {
+            return;
+        }
+        for (size_t i = 0; i < columns_.count; i += validation_block) {
+            ensure_valid(i);
+        }
+    }
+    
+    void check_index(size_t index) const {
+        if (index >= columns_.count) {
+            throw std::out_of_range("Index out of range");
+        }
+        ensure_valid(index);
+    }
+
+public:
+    explicit MappedFigureFile(const std::string& path, FigureFileValidation validation = FigureFileValidation::Lazy)
+        : validation_(validation) {
+        if constexpr (std::endian::native != std::endian::little) {
+            throw std::runtime_error("Zero-copy figure files require a little-endian host");
+        }
+        
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open figure file: " + path);
+        }
+        
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(FigureFileHeader::encoded_size)) {
+            close(fd);
+            throw std::runtime_error("Not a figure file");
+        }
+        
+        mapping_size_ = static_cast<size_t>(info.st_size);
+        void* mapping = mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapping == MAP_FAILED) {
+            mapping_size_ = 0;
+            throw std::runtime_error("Cannot map figure file: " + path);
+        }
+        mapping_ = static_cast<const unsigned char*>(mapping);
+        
+        try {
+            header_ = figure_file_detail::decode_header(mapping_, mapping_size_);
+            check_layout();
+        } catch (...) {
+            unmap();
+            throw;
+        }
+        
+        columns_.kinds = reinterpret_cast<const FigureKind*>(mapping_ + header_.offsets[0]);
+        for (size_t k = 0; k < vertices_per_figure; ++k) {
+            columns_.x[k] = reinterpret_cast<const T*>(mapping_ + header_.offsets[1 + k]);
+            columns_.y[k] = reinterpret_cast<const T*>(mapping_ + header_.offsets[5 + k]);
+        }
+        columns_.count = static_cast<size_t>(header_.count);
+        
+        if (validation_ == FigureFileValidation::Eager) {
+            try {
+                validate_range(0, columns_.count);
+            } catch (...) {
+                unmap();
+                throw;
+            }
+        } else if (validation_ == FigureFileValidation::Lazy) {
+            size_t blocks = (columns_.count + validation_block - 1) / validation_block;
+            validated_blocks_ = std::make_unique<std::atomic<bool>[]>(blocks);
+        }
+    }
+    
+    MappedFigureFile(const MappedFigureFile& other) = delete;
+    
+    MappedFigureFile(MappedFigureFile&& other) noexcept
+        : mapping_(std::exchange(other.mapping_, nullptr)),
+          mapping_size_(std::exchange(other.mapping_size_, 0)),
+          header_(other.header_),
+          columns_(std::exchange(other.columns_, QuadColumns<T>())),
+          validation_(other.validation_),
+          validated_blocks_(std::move(other.validated_blocks_)) {}
+    
+    MappedFigureFile& operator=(const MappedFigureFile& other) = delete;
+    
+    MappedFigureFile& operator=(MappedFigureFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            mapping_ = std::exchange(other.mapping_, nullptr);
+            mapping_size_ = std::exchange(other.mapping_size_, 0);
+            header_ = other.header_;
+            columns_ = std::exchange(other.columns_, QuadColumns<T>());
+            validation_ = other.validation_;
+            validated_blocks_ = std::move(other.validated_blocks_);
+        }
+        return *this;
+    }
+    
+    ~MappedFigureFile() {
+        unmap();
+    }
+    
+    size_t size() const {
+        return columns_.count;
+    }
+    
+    bool empty() const {
+        return columns_.count == 0;
+    }
+    
+    const FigureFileHeader& header() const {
+        return header_;
+    }
+    
+    FigureKind kind(size_t index) const {
+        check_index(index);
+        return columns_.kinds[index];
+    }
+    
+    Point<T> get_vertex(size_t index, size_t k) const {
+        check_index(index);
+        if (k >= vertices_per_figure) {
+            throw std::out_of_range("Index out of range");
+        }
+        return Point<T>(columns_.x[k][index], columns_.y[k][index]);
+    }
+    
+    double area(size_t index) const {
+        check_index(index);
+        return simd_detail::quad_area(columns_, index);
+    }
+    
+    Point<T> center(size_t index) const {
+        check_index(index);
+        T sum_x = T{};
+        T sum_y = T{};
+        for (size_t k = 0; k < vertices_per_figure; ++k) {
+            sum_x += columns_.x[k][index];
+            sum_y += columns_.y[k][index];
+        }
+        return Point<T>(sum_x / static_cast<T>(vertices_per_figure),
+                       sum_y / static_cast<T>(vertices_per_figure));
+    }
+    
+    BoundingBox<T> bounding_box(size_t index) const {
+        BoundingBox<T> box(get_vertex(index, 0));
+        for (size_t k = 1; k < vertices_per_figure; ++k) {
+            box.expand(Point<T>(columns_.x[k][index], columns_.y[k][index]));
+        }
+        return box;
+    }
+    
+    void validate() const {
+        if (validation_ == FigureFileValidation::None) {
+            validate_range(0, columns_.count);
+        } else {
+            ensure_all_valid();
+        }
+    }
+    
+    QuadColumns<T> columns() const {
+        ensure_all_valid();
+        return columns_;
+    }
+    
+    void areas(double* out) const {
+        batch_areas(columns(), out);
+    }
+    
+    void centers(T* center_x, T* center_y) const {
+        batch_centers(columns(), center_x, center_y);
+    }
+    
+    double total_area() const {
+        return batch_total_area(columns());
+    }
+    
+    std::shared_ptr<Figure<T>> make_figure(size_t index) const {
+        check_index(index);
+        
+        T x1 = columns_.x[0][index], y1 = columns_.y[0][index];
+        T x2 = columns_.x[1][index], y2 = columns_.y[1][index];
+        T x3 = columns_.x[2][index], y3 = columns_.y[2][index];
+        T x4 = columns_.x[3][index], y4 = columns_.y[3][index];
+        
+        switch (columns_.kinds[index]) {
+            case FigureKind::Rectangle:
+                return std::make_shared<Rectangle<T>>(x1, y1, x2, y2, x3, y3, x4, y4);
+            case FigureKind::Trapezoid:
+                return std::make_shared<Trapezoid<T>>(x1, y1, x2, y2, x3, y3, x4, y4);
+            case FigureKind::Rhombus:
+                return std::make_shared<Rhombus<T>>(x1, y1, x2, y2, x3, y3, x4, y4);
+        }
+        throw std::invalid_argument("Unsupported figure type");
+    }
+};
@@ -2,66 +2,93 @@
 #include <iostream>
 #include <concepts>
 #include <cmath>
+#include <limits>
+#include <type_traits>
 
 template<typename T>
 concept Scalar = std::is_arithmetic_v<T>;
 
+template<typename T>
+concept IntegralScalar = Scalar<T> && std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 4;
+
+namespace point_detail {
+
+template<class V>
+constexpr V constexpr_abs(V value) {
+    return value < V{} ? -value : value;
+}
+
+constexpr double constexpr_sqrt(double value) {
+    if (!std::is_constant_evaluated()) {
+        return std::sqrt(value);
+    }
+    if (value < 0.0 || value != value) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (value == 0.0 || value == std::numeric_limits<double>::infinity()) {
+        return value;
+    }
+    
+    double current = value < 1.0 ? 1.0 : value;
+    while (true) {
+        double next = 0.5 * (current + value / current);
+        if (next >= current) {
+            return current;
+        }
+        current = next;
+    }
+}
+
+}
+
 template<Scalar T>
 class Point {
 private:
     T x_, y_;
 
 public:
-    Point() : x_(T{}), y_(T{}) {}
+    constexpr Point() : x_(T{}), y_(T{}) {}
     
-    Point(T x, T y) : x_(x), y_(y) {}
+    constexpr Point(T x, T y) : x_(x), y_(y) {}
     
-    Point(const Point& other) : x_(other.x_), y_(other.y_) {}
+    constexpr Point(const Point& other) = default;
     
-    Point(Point&& other) noexcept : x_(std::move(other.x_)), y_(std::move(other.y_)) {}
+    constexpr Point(Point&& other) noexcept = default;
     
-    Point& operator=(const Point& other) {
-        if (this != &other) {
-            x_ = other.x_;
-            y_ = other.y_;
-        }
-        return *this;
-    }
+    constexpr Point& operator=(const Point& other) = default;
     
-    Point& operator=(Point&& other) noexcept {
-        if (this != &other) {
-            x_ = std::move(other.x_);
-            y_ = std::move(other.y_);
-        }
-        return *this;
-    }
+    constexpr Point& operator=(Point&& other) noexcept = default;
     
-    T x() const { return x_; }
-    T y() const { return y_; }
+    constexpr T x() const { return x_; }
+    constexpr T y() const { return y_; }
     
-    void set_x(T x) { x_ = x; }
-    void set_y(T y) { y_ = y; }
+    constexpr void set_x(T x) { x_ = x; }
+    constexpr void set_y(T y) { y_ = y; }
     
-    bool operator==(const Point& other) const {
-        return std::abs(x_ - other.x_) < 1e-9 && std::abs(y_ - other.y_) < 1e-9;
+    constexpr bool operator==(const Point& other) const {
+        if constexpr (std::is_integral_v<T>) {
+            return x_ == other.x_ && y_ == other.y_;
+        } else {
+            return point_detail::constexpr_abs(x_ - other.x_) < 1e-9 && point_detail::constexpr_abs(y_ - other.y_) < 1e-9;
+        }
     }
     
-    bool operator!=(const Point& other) const {
+    constexpr bool operator!=(const Point& other) const {
         return !(*this == other);
     }
     
-    Point operator+(const Point& other) const {
+    constexpr Point operator+(const Point& other) const {
         return Point(x_ + other.x_, y_ + other.y_);
     }
     
-    Point operator-(const Point& other) const {
+    constexpr Point operator-(const Point& other) const {
         return Point(x_ - other.x_, y_ - other.y_);
     }
     
-    double distance(const Point& other) const {
-        T dx = x_ - other.x_;
-        T dy = y_ - other.y_;
-        return std::sqrt(dx * dx + dy * dy);
+    constexpr double distance(const Point& other) const {
+        double dx = static_cast<double>(x_) - static_cast<double>(other.x_);
+        double dy = static_cast<double>(y_) - static_cast<double>(other.y_);
+        return point_detail::constexpr_sqrt(dx * dx + dy * dy);
     }
     
     friend std::ostream& operator<<(std::ostream& os, const Point& p) {
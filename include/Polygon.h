@@ -0,0 +1,195 @@
+#pragma once
+#include "FixedFigure.h"
+#include "ExactGeometry.h"
+#include "SimdKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+
+template<Scalar T, size_t N = 64>
+class Polygon : public FixedFigure<T, N> {
+    static_assert(N >= 3, "Polygon needs room for at least three vertices");
+
+public:
+    Polygon() = default;
+    
+    explicit Polygon(std::span<const Point<T>> vertices) {
+        if (vertices.size() < 3 || vertices.size() > N) {
+            throw std::invalid_argument("Polygon vertex count out of range");
+        }
+        for (const Point<T>& vertex : vertices) {
+            this->add_vertex(vertex.x(), vertex.y());
+        }
+        
+        if (!has_valid_shape()) {
+            throw std::invalid_argument("Points do not form a simple polygon");
+        }
+    }
+    
+    Polygon(std::initializer_list<Point<T>> vertices)
+        : Polygon(std::span<const Point<T>>(vertices.begin(), vertices.size())) {}
+    
+    Polygon(const Polygon& other) : FixedFigure<T, N>(other) {}
+    
+    Polygon(Polygon&& other) noexcept : FixedFigure<T, N>(std::move(other)) {}
+    
+    Polygon& operator=(const Polygon& other) {
+        if (this != &other) {
+            FixedFigure<T, N>::operator=(other);
+        }
+        return *this;
+    }
+    
+    Polygon& operator=(Polygon&& other) noexcept {
+        if (this != &other) {
+            FixedFigure<T, N>::operator=(std::move(other));
+        }
+        return *this;
+    }
+    
+    auto twice_signed_area() const {
+        if constexpr (IntegralScalar<T>) {
+            return ::twice_signed_area<T>(this->vertices());
+        } else {
+            return polygon_moments<T>(this->vertices()).twice_area;
+        }
+    }
+    
+    Point<double> centroid() const {
+        std::span<const Point<T>> points = this->vertices();
+        if (points.empty()) {
+            return Point<double>();
+        }
+        
+        PolygonMoments moments = polygon_moments<T>(points);
+        if (moments.twice_area == 0.0) {
+            return Point<double>();
+        }
+        return Point<double>(static_cast<double>(points[0].x()) + moments.x / (3.0 * moments.twice_area),
+                             static_cast<double>(points[0].y()) + moments.y / (3.0 * moments.twice_area));
+    }
+    
+    bool is_convex() const {
+        size_t count = this->count_;
+        if (count < 3) {
+            return false;
+        }
+        
+        int turn = 0;
+        int x_flips = 0;
+        int y_flips = 0;
+        int x_sign = 0;
+        int y_sign = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const Point<T>& a = this->vertices_[i];
+            const Point<T>& b = this->vertices_[(i + 1) % count];
+            const Point<T>& c = this->vertices_[(i + 2) % count];
+            
+            int orientation = orient(a, b, c);
+            if (orientation != 0) {
+                if (turn != 0 && orientation != turn) {
+                    return false;
+                }
+                turn = orientation;
+            }
+            
+            int dx = sign_of(b.x(), a.x());
+            int dy = sign_of(b.y(), a.y());
+            if (dx != 0) {
+                x_flips += x_sign != 0 && dx != x_sign;
+                x_sign = dx;
+            }
+            if (dy != 0) {
+                y_flips += y_sign != 0 && dy != y_sign;
+                y_sign = dy;
+            }
+        }
+        return turn != 0 && x_flips <= 2 && y_flips <= 2;
+    }
+    
+    bool is_simple() const {
+        size_t count = this->count_;
+        if (count < 3) {
+            return false;
+        }
+        if (is_convex()) {
+            return true;
+        }
+        
+        for (size_t i = 0; i < count; ++i) {
+            const Point<T>& a = this->vertices_[i];
+            const Point<T>& b = this->vertices_[(i + 1) % count];
+            if (a == b) {
+                return false;
+            }
+            
+            for (size_t j = i + 1; j < count; ++j) {
+                bool adjacent = j == i + 1 || (i == 0 && j == count - 1);
+                const Point<T>& c = this->vertices_[j];
+                const Point<T>& d = this->vertices_[(j + 1) % count];
+                if (adjacent) {
+                    const Point<T>& shared = j == i + 1 ? b : a;
+                    const Point<T>& other = j == i + 1 ? d : c;
+                    const Point<T>& own = j == i + 1 ? a : b;
+                    if (orient(own, shared, other) == 0 &&
+                        (on_segment(shared, other, own) || on_segment(own, shared, other))) {
+                        return false;
+                    }
+                } else if (segments_intersect(a, b, c, d)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+protected:
+    bool has_valid_shape() const override {
+        return twice_signed_area() != 0 && is_simple();
+    }
+    
+    double compute_area() const override {
+        if constexpr (IntegralScalar<T>) {
+            return exact_area<T>(this->vertices());
+        } else {
+            return std::abs(polygon_moments<T>(this->vertices()).twice_area) / 2.0;
+        }
+    }
+
+private:
+    static int sign_of(T a, T b) {
+        return a > b ? 1 : (a < b ? -1 : 0);
+    }
+    
+    static int orient(const Point<T>& a, const Point<T>& b, const Point<T>& c) {
+        if constexpr (IntegralScalar<T>) {
+            using Wide = ExactWide<T>;
+            Wide cross = (Wide(b.x()) - a.x()) * (Wide(c.y()) - a.y()) - (Wide(b.y()) - a.y()) * (Wide(c.x()) - a.x());
+            return cross > 0 ? 1 : (cross < 0 ? -1 : 0);
+        } else {
+            double cross = (static_cast<double>(b.x()) - a.x()) * (static_cast<double>(c.y()) - a.y()) -
+                           (static_cast<double>(b.y()) - a.y()) * (static_cast<double>(c.x()) - a.x());
+            return cross > 0 ? 1 : (cross < 0 ? -1 : 0);
+        }
+    }
+    
+    static bool on_segment(const Point<T>& a, const Point<T>& b, const Point<T>& p) {
+        return std::min(a.x(), b.x()) <= p.x() && p.x() <= std::max(a.x(), b.x()) &&
+               std::min(a.y(), b.y()) <= p.y() && p.y() <= std::max(a.y(), b.y());
+    }
+    
+    static bool segments_intersect(const Point<T>& a, const Point<T>& b, const Point<T>& c, const Point<T>& d) {
+        int o1 = orient(a, b, c);
+        int o2 = orient(a, b, d);
+        int o3 = orient(c, d, a);
+        int o4 = orient(c, d, b);
+        
+        if (o1 * o2 < 0 && o3 * o4 < 0) {
+            return true;
+        }
+        return (o1 == 0 && on_segment(a, b, c)) || (o2 == 0 && on_segment(a, b, d)) ||
+               (o3 == 0 && on_segment(c, d, a)) || (o4 == 0 && on_segment(c, d, b));
+    }
+};
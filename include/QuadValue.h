@@ -0,0 +1,118 @@
+#pragma once
+#include "Point.h"
+#include "BoundingBox.h"
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+namespace quad_value_detail {
+
+constexpr double relative_tolerance = 1e-9;
+constexpr double absolute_tolerance = 1e-9;
+
+template<Scalar T>
+constexpr double squared_distance(const Point<T>& a, const Point<T>& b) {
+    double dx = static_cast<double>(a.x()) - static_cast<double>(b.x());
+    double dy = static_cast<double>(a.y()) - static_cast<double>(b.y());
+    return dx * dx + dy * dy;
+}
+
+constexpr bool nearly_equal_squared(double a, double b) {
+    return point_detail::constexpr_abs(a - b) <= relative_tolerance * std::max(a, b);
+}
+
+template<Scalar T>
+constexpr double corner_cross(const Point<T>& a, const Point<T>& b, const Point<T>& c) {
+    double ux = static_cast<double>(b.x()) - static_cast<double>(a.x());
+    double uy = static_cast<double>(b.y()) - static_cast<double>(a.y());
+    double vx = static_cast<double>(c.x()) - static_cast<double>(b.x());
+    double vy = static_cast<double>(c.y()) - static_cast<double>(b.y());
+    return ux * vy - uy * vx;
+}
+
+template<Scalar T>
+constexpr bool turns_one_way(const std::array<Point<T>, 4>& v) {
+    bool left = true;
+    bool right = true;
+    for (size_t k = 0; k < 4; ++k) {
+        double cross = corner_cross(v[k], v[(k + 1) % 4], v[(k + 2) % 4]);
+        left = left && cross > 0.0;
+        right = right && cross < 0.0;
+    }
+    return left || right;
+}
+
+}
+
+template<Scalar T>
+class QuadValue {
+public:
+    static constexpr size_t vertex_count = 4;
+    
+    using Vertices = std::array<Point<T>, vertex_count>;
+
+protected:
+    Vertices vertices_;
+    
+    constexpr QuadValue() = default;
+    
+    constexpr explicit QuadValue(const Vertices& vertices) : vertices_(vertices) {}
+    
+    constexpr QuadValue(T x1, T y1, T x2, T y2, T x3, T y3, T x4, T y4)
+        : vertices_{Point<T>(x1, y1), Point<T>(x2, y2), Point<T>(x3, y3), Point<T>(x4, y4)} {}
+    
+    constexpr QuadValue(const QuadValue& other) = default;
+    
+    constexpr QuadValue(QuadValue&& other) noexcept = default;
+    
+    constexpr QuadValue& operator=(const QuadValue& other) = default;
+    
+    constexpr QuadValue& operator=(QuadValue&& other) noexcept = default;
+    
+    static constexpr Point<T> center_of(const Vertices& vertices) {
+        T sum_x = T{};
+        T sum_y = T{};
+        for (const Point<T>& vertex : vertices) {
+            sum_x += vertex.x();
+            sum_y += vertex.y();
+        }
+        return Point<T>(sum_x / static_cast<T>(vertex_count), sum_y / static_cast<T>(vertex_count));
+    }
+
+public:
+    constexpr const Vertices& vertices() const {
+        return vertices_;
+    }
+    
+    constexpr Point<T> get_vertex(size_t index) const {
+        if (index >= vertex_count) {
+            throw std::out_of_range("Index out of range");
+        }
+        return vertices_[index];
+    }
+    
+    constexpr Point<T> center() const {
+        return center_of(vertices_);
+    }
+    
+    constexpr BoundingBox<T> bounding_box() const {
+        BoundingBox<T> box(vertices_[0]);
+        for (size_t i = 1; i < vertex_count; ++i) {
+            box.expand(vertices_[i]);
+        }
+        return box;
+    }
+    
+    constexpr bool operator==(const QuadValue& other) const {
+        for (size_t i = 0; i < vertex_count; ++i) {
+            if (vertices_[i] != other.vertices_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    constexpr bool operator!=(const QuadValue& other) const {
+        return !(*this == other);
+    }
+};
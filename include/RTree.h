@@ -0,0 +1,340 @@
+#pragma once
+#include "Point.h"
+#include "BoundingBox.h"
+#include "Figure.h"
+#include "Array.h"
+#include "FigureStore.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+template<Scalar T, size_t MaxEntries = 16>
+class RTree {
+    static_assert(MaxEntries >= 2, "RTree nodes must hold at least two entries");
+
+public:
+    struct Entry {
+        BoundingBox<T> box;
+        size_t value;
+    };
+
+private:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    
+    struct Node {
+        size_t level = 0;
+        std::vector<Entry> entries;
+    };
+    
+    std::vector<Node> nodes_;
+    std::vector<size_t> free_nodes_;
+    size_t root_ = npos;
+    size_t size_ = 0;
+    
+    size_t allocate_node(size_t level) {
+        size_t index;
+        if (!free_nodes_.empty()) {
+            index = free_nodes_.back();
+            free_nodes_.pop_back();
+        } else {
+            index = nodes_.size();
+            nodes_.emplace_back();
+        }
+        nodes_[index].level = level;
+        nodes_[index].entries.clear();
+        nodes_[index].entries.reserve(MaxEntries + 1);
+        return index;
+    }
+    
+    void free_node(size_t index) {
+        nodes_[index].entries.clear();
+        free_nodes_.push_back(index);
+    }
+    
+    BoundingBox<T> node_bounds(size_t index) const {
+        const std::vector<Entry>& entries = nodes_[index].entries;
+        BoundingBox<T> box = entries[0].box;
+        for (size_t i = 1; i < entries.size(); ++i) {
+            box.expand(entries[i].box);
+        }
+        return box;
+    }
+    
+    static void sort_by_center(std::vector<Entry>& entries, size_t begin, size_t end, bool by_x) {
+        std::sort(entries.begin() + begin, entries.begin() + end, [by_x](const Entry& a, const Entry& b) {
+            return by_x ? a.box.center_x() < b.box.center_x() : a.box.center_y() < b.box.center_y();
+        });
+    }
+    
+    std::vector<Entry> pack_level(std::vector<Entry>& entries, size_t level) {
+        size_t count = entries.size();
+        size_t node_count = (count + MaxEntries - 1) / MaxEntries;
+        size_t slice_count = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(node_count))));
+        size_t slice_size = slice_count * MaxEntries;
+        
+        sort_by_center(entries, 0, count, true);
+        
+        std::vector<Entry> parents;
+        parents.reserve(node_count);
+        for (size_t slice = 0; slice < count; slice += slice_size) {
+            size_t slice_end = std::min(slice + slice_size, count);
+            sort_by_center(entries, slice, slice_end, false);
+            
+            for (size_t begin = slice; begin < slice_end; begin += MaxEntries) {
+                size_t end = std::min(begin + MaxEntries, slice_end);
+                size_t node = allocate_node(level);
+                nodes_[node].entries.assign(entries.begin() + begin, entries.begin() + end);
+                parents.push_back(Entry{node_bounds(node), node});
+            }
+        }
+        return parents;
+    }
+    
+    size_t choose_child(size_t node, const BoundingBox<T>& box) const {
+        const std::vector<Entry>& entries = nodes_[node].entries;
+        size_t best = 0;
+        double best_enlargement = std::numeric_limits<double>::infinity();
+        double best_area = std::numeric_limits<double>::infinity();
+        
+        for (size_t i = 0; i < entries.size(); ++i) {
+            double enlargement = entries[i].box.enlargement(box);
+            double area = entries[i].box.area();
+            if (enlargement < best_enlargement || (enlargement == best_enlargement && area < best_area)) {
+                best = i;
+                best_enlargement = enlargement;
+                best_area = area;
+            }
+        }
+        return best;
+    }
+    
+    size_t split(size_t node) {
+        std::vector<Entry>& entries = nodes_[node].entries;
+        BoundingBox<T> bounds = node_bounds(node);
+        sort_by_center(entries, 0, entries.size(), bounds.width() >= bounds.height());
+        
+        size_t half = entries.size() / 2;
+        std::vector<Entry> upper(entries.begin() + half, entries.end());
+        entries.resize(half);
+        
+        size_t sibling = allocate_node(nodes_[node].level);
+        nodes_[sibling].entries = std::move(upper);
+        return sibling;
+    }
+    
+    bool remove_from(size_t node, size_t id, const BoundingBox<T>& box) {
+        std::vector<Entry>& entries = nodes_[node].entries;
+        
+        if (nodes_[node].level == 0) {
+            for (size_t i = 0; i < entries.size(); ++i) {
+                if (entries[i].value == id && entries[i].box == box) {
+                    entries[i] = entries.back();
+                    entries.pop_back();
+                    return true;
+                }
+            }
+            return false;
+        }
+        
+        for (size_t i = 0; i < nodes_[node].entries.size(); ++i) {
+            Entry& entry = nodes_[node].entries[i];
+            if (!entry.box.contains(box)) {
+                continue;
+            }
+            
+            size_t child = entry.value;
+            if (!remove_from(child, id, box)) {
+                continue;
+            }
+            
+            std::vector<Entry>& current = nodes_[node].entries;
+            if (nodes_[child].entries.empty()) {
+                free_node(child);
+                current[i] = current.back();
+                current.pop_back();
+            } else {
+                current[i].box = node_bounds(child);
+            }
+            return true;
+        }
+        return false;
+    }
+    
+    template<class Visitor>
+    void visit(const BoundingBox<T>& window, Visitor&& visitor) const {
+        if (root_ == npos) {
+            return;
+        }
+        
+        std::vector<size_t> stack;
+        stack.push_back(root_);
+        while (!stack.empty()) {
+            const Node& node = nodes_[stack.back()];
+            stack.pop_back();
+            
+            for (const Entry& entry : node.entries) {
+                if (!entry.box.intersects(window)) {
+                    continue;
+                }
+                if (node.level == 0) {
+                    visitor(entry.value);
+                } else {
+                    stack.push_back(entry.value);
+                }
+            }
+        }
+    }
+
+public:
+    static constexpr size_t max_entries = MaxEntries;
+    
+    RTree() = default;
+    
+    explicit RTree(std::vector<Entry> entries) {
+        bulk_load(std::move(entries));
+    }
+    
+    template<class... Policies>
+    explicit RTree(const Array<std::shared_ptr<Figure<T>>, Policies...>& figures) {
+        std::vector<Entry> entries;
+        entries.reserve(figures.size());
+        for (size_t i = 0; i < figures.size(); ++i) {
+            entries.push_back(Entry{figures[i]->bounding_box(), i});
+        }
+        bulk_load(std::move(entries));
+    }
+    
+    explicit RTree(const FigureStore<T>& store) {
+        std::vector<Entry> entries;
+        entries.reserve(store.size());
+        for (size_t i = 0; i < store.size(); ++i) {
+            entries.push_back(Entry{store.bounding_box(i), i});
+        }
+        bulk_load(std::move(entries));
+    }
+    
+    RTree(const RTree& other) = default;
+    
+    RTree(RTree&& other) noexcept = default;
+    
+    RTree& operator=(const RTree& other) = default;
+    
+    RTree& operator=(RTree&& other) noexcept = default;
+    
+    void bulk_load(std::vector<Entry> entries) {
+        clear();
+        if (entries.empty()) {
+            return;
+        }
+        
+        size_ = entries.size();
+        size_t level = 0;
+        while (entries.size() > MaxEntries || level == 0) {
+            entries = pack_level(entries, level++);
+            if (entries.size() == 1) {
+                root_ = entries[0].value;
+                return;
+            }
+        }
+        
+        root_ = allocate_node(level);
+        nodes_[root_].entries = std::move(entries);
+    }
+    
+    void insert(size_t id, const BoundingBox<T>& box) {
+        ++size_;
+        if (root_ == npos) {
+            root_ = allocate_node(0);
+            nodes_[root_].entries.push_back(Entry{box, id});
+            return;
+        }
+        
+        std::vector<std::pair<size_t, size_t>> path;
+        size_t node = root_;
+        while (nodes_[node].level > 0) {
+            size_t slot = choose_child(node, box);
+            path.emplace_back(node, slot);
+            nodes_[node].entries[slot].box.expand(box);
+            node = nodes_[node].entries[slot].value;
+        }
+        nodes_[node].entries.push_back(Entry{box, id});
+        
+        while (nodes_[node].entries.size() > MaxEntries) {
+            size_t sibling = split(node);
+            if (path.empty()) {
+                size_t new_root = allocate_node(nodes_[node].level + 1);
+                nodes_[new_root].entries.push_back(Entry{node_bounds(node), node});
+                nodes_[new_root].entries.push_back(Entry{node_bounds(sibling), sibling});
+                root_ = new_root;
+                return;
+            }
+            
+            auto [parent, slot] = path.back();
+            path.pop_back();
+            nodes_[parent].entries[slot].box = node_bounds(node);
+            nodes_[parent].entries.push_back(Entry{node_bounds(sibling), sibling});
+            node = parent;
+        }
+    }
+    
+    bool remove(size_t id, const BoundingBox<T>& box) {
+        if (root_ == npos || !remove_from(root_, id, box)) {
+            return false;
+        }
+        
+        --size_;
+        while (nodes_[root_].level > 0 && nodes_[root_].entries.size() == 1) {
+            size_t child = nodes_[root_].entries[0].value;
+            free_node(root_);
+            root_ = child;
+        }
+        if (nodes_[root_].entries.empty()) {
+            clear();
+        }
+        return true;
+    }
+    
+    void query(const BoundingBox<T>& window, std::vector<size_t>& out) const {
+        visit(window, [&out](size_t id) { out.push_back(id); });
+    }
+    
+    std::vector<size_t> query(const BoundingBox<T>& window) const {
+        std::vector<size_t> result;
+        query(window, result);
+        return result;
+    }
+    
+    void stab(const Point<T>& point, std::vector<size_t>& out) const {
+        query(BoundingBox<T>(point), out);
+    }
+    
+    std::vector<size_t> stab(const Point<T>& point) const {
+        return query(BoundingBox<T>(point));
+    }
+    
+    size_t size() const {
+        return size_;
+    }
+    
+    bool empty() const {
+        return size_ == 0;
+    }
+    
+    size_t height() const {
+        return root_ == npos ? 0 : nodes_[root_].level + 1;
+    }
+    
+    BoundingBox<T> bounds() const {
+        return root_ == npos ? BoundingBox<T>() : node_bounds(root_);
+    }
+    
+    void clear() {
+        nodes_.clear();
+        free_nodes_.clear();
+        root_ = npos;
+        size_ = 0;
+    }
+};
@@ -1,10 +1,11 @@
 #pragma once
-#include "Figure.h"
+#include "FixedFigure.h"
+#include "RectangleValue.h"
 #include <stdexcept>
 #include <cmath>
 
 template<Scalar T>
-class Rectangle : public Figure<T> {
+class Rectangle : public FixedFigure<T, 4> {
 public:
     Rectangle() = default;
     
@@ -16,84 +17,90 @@ public:
         T half_width = width / 2;
         T half_height = height / 2;
         
-        this->vertices_.push_back(std::make_unique<Point<T>>(center.x() - half_width, center.y() - half_height));
-        this->vertices_.push_back(std::make_unique<Point<T>>(center.x() + half_width, center.y() - half_height));
-        this->vertices_.push_back(std::make_unique<Point<T>>(center.x() + half_width, center.y() + half_height));
-        this->vertices_.push_back(std::make_unique<Point<T>>(center.x() - half_width, center.y() + half_height));
+        this->add_vertex(center.x() - half_width, center.y() - half_height);
+        this->add_vertex(center.x() + half_width, center.y() - half_height);
+        this->add_vertex(center.x() + half_width, center.y() + half_height);
+        this->add_vertex(center.x() - half_width, center.y() + half_height);
     }
     
     Rectangle(T x1, T y1, T x2, T y2, T x3, T y3, T x4, T y4) {
-        this->vertices_.push_back(std::make_unique<Point<T>>(x1, y1));
-        this->vertices_.push_back(std::make_unique<Point<T>>(x2, y2));
-        this->vertices_.push_back(std::make_unique<Point<T>>(x3, y3));
-        this->vertices_.push_back(std::make_unique<Point<T>>(x4, y4));
+        this->add_vertex(x1, y1);
+        this->add_vertex(x2, y2);
+        this->add_vertex(x3, y3);
+        this->add_vertex(x4, y4);
         
         if (!is_valid_rectangle()) {
             throw std::invalid_argument("Points do not form a valid rectangle");
         }
     }
     
-    Rectangle(const Rectangle& other) : Figure<T>(other) {}
+    explicit Rectangle(const RectangleValue<T>& value) {
+        for (const Point<T>& vertex : value.vertices()) {
+            this->add_vertex(vertex.x(), vertex.y());
+        }
+    }
+    
+    Rectangle(const Rectangle& other) : FixedFigure<T, 4>(other) {}
     
-    Rectangle(Rectangle&& other) noexcept : Figure<T>(std::move(other)) {}
+    Rectangle(Rectangle&& other) noexcept : FixedFigure<T, 4>(std::move(other)) {}
     
     Rectangle& operator=(const Rectangle& other) {
         if (this != &other) {
-            Figure<T>::operator=(other);
+            FixedFigure<T, 4>::operator=(other);
         }
         return *this;
     }
     
     Rectangle& operator=(Rectangle&& other) noexcept {
         if (this != &other) {
-            Figure<T>::operator=(std::move(other));
+            FixedFigure<T, 4>::operator=(std::move(other));
         }
         return *this;
     }
     
-    double area() const override {
-        if (this->vertices_.size() != 4) {
-            return 0.0;
+    RectangleValue<T> value() const {
+        if (this->count_ != 4) {
+            return RectangleValue<T>();
         }
-        
-        double side1 = this->vertices_[0]->distance(*this->vertices_[1]);
-        double side2 = this->vertices_[1]->distance(*this->vertices_[2]);
-        
-        return side1 * side2;
+        return RectangleValue<T>::from_validated(this->vertices_);
     }
     
     T width() const {
-        if (this->vertices_.size() != 4) {
+        if (this->count_ != 4) {
             return T{};
         }
-        return static_cast<T>(this->vertices_[0]->distance(*this->vertices_[1]));
+        return static_cast<T>(this->vertices_[0].distance(this->vertices_[1]));
     }
     
     T height() const {
-        if (this->vertices_.size() != 4) {
+        if (this->count_ != 4) {
             return T{};
         }
-        return static_cast<T>(this->vertices_[1]->distance(*this->vertices_[2]));
+        return static_cast<T>(this->vertices_[1].distance(this->vertices_[2]));
     }
 
-private:
-    bool is_valid_rectangle() const {
-        if (this->vertices_.size() != 4) {
-            return false;
+protected:
+    bool has_valid_shape() const override {
+        return is_valid_rectangle();
+    }
+    
+    double compute_area() const override {
+        if (this->count_ != 4) {
+            return 0.0;
         }
         
-        double side1 = this->vertices_[0]->distance(*this->vertices_[1]);
-        double side2 = this->vertices_[1]->distance(*this->vertices_[2]);
-        double side3 = this->vertices_[2]->distance(*this->vertices_[3]);
-        double side4 = this->vertices_[3]->distance(*this->vertices_[0]);
-        
-        double diag1 = this->vertices_[0]->distance(*this->vertices_[2]);
-        double diag2 = this->vertices_[1]->distance(*this->vertices_[3]);
-        
-        const double eps = 1e-9;
-        
-        return (std::abs(side1 - side3) < eps) && 
-               (std::abs(side2 - side4) < eps) && 
-               (std::abs(diag1 - diag2) < eps);
+        if constexpr (IntegralScalar<T>) {
+            return exact_area<T>(this->vertices());
+        } else {
+            double side1 = this->vertices_[0].distance(this->vertices_[1]);
+            double side2 = this->vertices_[1].distance(this->vertices_[2]);
+            
+            return side1 * side2;
+        }
+    }
+
+private:
+    bool is_valid_rectangle() const {
+        return this->count_ == 4 && RectangleValue<T>::is_valid(this->vertices_);
     }
 };
@@ -0,0 +1,80 @@
+#pragma once
+#include "QuadValue.h"
+#include "ExactGeometry.h"
+#include "FigureKind.h"
+#include <stdexcept>
+
+template<Scalar T>
+class RectangleValue : public QuadValue<T> {
+public:
+    using typename QuadValue<T>::Vertices;
+    
+    static constexpr FigureKind kind = FigureKind::Rectangle;
+    
+    constexpr RectangleValue() = default;
+    
+    constexpr RectangleValue(const Point<T>& center, T width, T height) {
+        if (width <= 0 || height <= 0) {
+            throw std::invalid_argument("Width and height must be positive");
+        }
+        
+        T half_width = width / 2;
+        T half_height = height / 2;
+        
+        this->vertices_ = {Point<T>(center.x() - half_width, center.y() - half_height),
+                           Point<T>(center.x() + half_width, center.y() - half_height),
+                           Point<T>(center.x() + half_width, center.y() + half_height),
+                           Point<T>(center.x() - half_width, center.y() + half_height)};
+    }
+    
+    constexpr RectangleValue(T x1, T y1, T x2, T y2, T x3, T y3, T x4, T y4)
+        : QuadValue<T>(x1, y1, x2, y2, x3, y3, x4, y4) {
+        if (!is_valid(this->vertices_)) {
+            throw std::invalid_argument("Points do not form a valid rectangle");
+        }
+    }
+    
+    constexpr RectangleValue(const RectangleValue& other) = default;
+    
+    constexpr RectangleValue(RectangleValue&& other) noexcept = default;
+    
+    constexpr RectangleValue& operator=(const RectangleValue& other) = default;
+    
+    constexpr RectangleValue& operator=(RectangleValue&& other) noexcept = default;
+    
+    static constexpr RectangleValue from_validated(const Vertices& vertices) {
+        return RectangleValue(vertices);
+    }
+    
+    static constexpr bool is_valid(const Vertices& v) {
+        using quad_value_detail::nearly_equal_squared;
+        using quad_value_detail::squared_distance;
+        
+        return nearly_equal_squared(squared_distance(v[0], v[1]), squared_distance(v[2], v[3])) &&
+               nearly_equal_squared(squared_distance(v[1], v[2]), squared_distance(v[3], v[0])) &&
+               nearly_equal_squared(squared_distance(v[0], v[2]), squared_distance(v[1], v[3])) &&
+               quad_value_detail::turns_one_way(v);
+    }
+    
+    constexpr T width() const {
+        return static_cast<T>(this->vertices_[0].distance(this->vertices_[1]));
+    }
+    
+    constexpr T height() const {
+        return static_cast<T>(this->vertices_[1].distance(this->vertices_[2]));
+    }
+    
+    constexpr double area() const {
+        if constexpr (IntegralScalar<T>) {
+            return exact_area<T>(this->vertices_);
+        } else {
+            double side1 = this->vertices_[0].distance(this->vertices_[1]);
+            double side2 = this->vertices_[1].distance(this->vertices_[2]);
+            
+            return side1 * side2;
+        }
+    }
+
+private:
+    constexpr explicit RectangleValue(const Vertices& vertices) : QuadValue<T>(vertices) {}
+};
@@ -0,0 +1,97 @@
+#pragma once
+#include "QuadValue.h"
+#include "ExactGeometry.h"
+#include "FigureKind.h"
+#include <stdexcept>
+
+template<Scalar T>
+class RhombusValue : public QuadValue<T> {
+public:
+    using typename QuadValue<T>::Vertices;
+    
+    static constexpr FigureKind kind = FigureKind::Rhombus;
+    
+    constexpr RhombusValue() = default;
+    
+    constexpr RhombusValue(const Point<T>& center, T diagonal1, T diagonal2) {
+        if (diagonal1 <= 0 || diagonal2 <= 0) {
+            throw std::invalid_argument("Diagonals must be positive");
+        }
+        
+        T half_d1 = diagonal1 / 2;
+        T half_d2 = diagonal2 / 2;
+        
+        this->vertices_ = {Point<T>(center.x(), center.y() + half_d2),
+                           Point<T>(center.x() + half_d1, center.y()),
+                           Point<T>(center.x(), center.y() - half_d2),
+                           Point<T>(center.x() - half_d1, center.y())};
+    }
+    
+    constexpr RhombusValue(T x1, T y1, T x2, T y2, T x3, T y3, T x4, T y4)
+        : QuadValue<T>(x1, y1, x2, y2, x3, y3, x4, y4) {
+        if (!is_valid(this->vertices_)) {
+            throw std::invalid_argument("Points do not form a valid rhombus");
+        }
+    }
+    
+    constexpr RhombusValue(const RhombusValue& other) = default;
+    
+    constexpr RhombusValue(RhombusValue&& other) noexcept = default;
+    
+    constexpr RhombusValue& operator=(const RhombusValue& other) = default;
+    
+    constexpr RhombusValue& operator=(RhombusValue&& other) noexcept = default;
+    
+    static constexpr RhombusValue from_validated(const Vertices& vertices) {
+        return RhombusValue(vertices);
+    }
+    
+    static constexpr bool is_valid(const Vertices& v) {
+        using quad_value_detail::absolute_tolerance;
+        using quad_value_detail::nearly_equal_squared;
+        using quad_value_detail::squared_distance;
+        
+        double side1 = squared_distance(v[0], v[1]);
+        double side2 = squared_distance(v[1], v[2]);
+        double side3 = squared_distance(v[2], v[3]);
+        double side4 = squared_distance(v[3], v[0]);
+        
+        bool all_sides_equal = nearly_equal_squared(side1, side2) && nearly_equal_squared(side2, side3) &&
+                               nearly_equal_squared(side3, side4);
+        
+        double bisect_x = (static_cast<double>(v[0].x()) + static_cast<double>(v[2].x())) -
+                          (static_cast<double>(v[1].x()) + static_cast<double>(v[3].x()));
+        double bisect_y = (static_cast<double>(v[0].y()) + static_cast<double>(v[2].y())) -
+                          (static_cast<double>(v[1].y()) + static_cast<double>(v[3].y()));
+        bool diagonals_bisect = point_detail::constexpr_abs(bisect_x) < 4 * absolute_tolerance &&
+                                point_detail::constexpr_abs(bisect_y) < 4 * absolute_tolerance;
+        
+        return all_sides_equal && diagonals_bisect;
+    }
+    
+    constexpr T diagonal1() const {
+        return static_cast<T>(this->vertices_[0].distance(this->vertices_[2]));
+    }
+    
+    constexpr T diagonal2() const {
+        return static_cast<T>(this->vertices_[1].distance(this->vertices_[3]));
+    }
+    
+    constexpr T side() const {
+        return static_cast<T>(this->vertices_[0].distance(this->vertices_[1]));
+    }
+    
+    constexpr double area() const {
+        if constexpr (IntegralScalar<T>) {
+            return exact_area<T>(this->vertices_);
+        } else {
+            double diagonal1 = this->vertices_[0].distance(this->vertices_[2]);
+            double diagonal2 = this->vertices_[1].distance(this->vertices_[3]);
+            
+            return (diagonal1 * diagonal2) / 2.0;
+        }
+    }
+
+private:
+    constexpr explicit RhombusValue(const Vertices& vertices) : QuadValue<T>(vertices) {}
+};
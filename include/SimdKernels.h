@@ -0,0 +1,429 @@
+#pragma once
+#include "Point.h"
+#include "FigureKind.h"
+#include "ExactGeometry.h"
+#include "AffineTransform.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define FIGURES_SIMD_X86 1
+#define FIGURES_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#else
+#define FIGURES_SIMD_X86 0
+#endif
+
+enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX2
+};
+
+inline SimdLevel detected_simd_level() {
+#if FIGURES_SIMD_X86
+    static const SimdLevel level = __builtin_cpu_supports("avx2") ? SimdLevel::AVX2 : SimdLevel::SSE2;
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+template<Scalar T>
+struct QuadColumns {
+    const FigureKind* kinds = nullptr;
+    std::array<const T*, 4> x{};
+    std::array<const T*, 4> y{};
+    size_t count = 0;
+    
+    QuadColumns slice(size_t begin, size_t length) const {
+        QuadColumns result = *this;
+        result.kinds += begin;
+        for (size_t k = 0; k < 4; ++k) {
+            result.x[k] += begin;
+            result.y[k] += begin;
+        }
+        result.count = length;
+        return result;
+    }
+};
+
+struct PolygonMoments {
+    double twice_area = 0.0;
+    double x = 0.0;
+    double y = 0.0;
+};
+
+namespace simd_detail {
+
+template<class T>
+concept Vectorizable = std::is_same_v<T, double> || std::is_same_v<T, float> ||
+                       (std::is_same_v<T, int> && sizeof(int) == 4);
+
+template<Scalar T>
+double quad_area(const QuadColumns<T>& columns, size_t i) {
+    auto point = [&](size_t k) { return Point<T>(columns.x[k][i], columns.y[k][i]); };
+    
+    if constexpr (IntegralScalar<T>) {
+        std::array<Point<T>, 4> vertices = {point(0), point(1), point(2), point(3)};
+        return exact_area<T>(vertices);
+    } else {
+        switch (columns.kinds[i]) {
+            case FigureKind::Rectangle:
+                return point(0).distance(point(1)) * point(1).distance(point(2));
+            case FigureKind::Rhombus:
+                return (point(0).distance(point(2)) * point(1).distance(point(3))) / 2.0;
+            case FigureKind::Trapezoid: {
+                double base1 = point(0).distance(point(1));
+                double base2 = point(2).distance(point(3));
+                double height = std::abs(columns.y[0][i] - columns.y[3][i]);
+                return (base1 + base2) * height / 2.0;
+            }
+        }
+        return 0.0;
+    }
+}
+
+template<Scalar T>
+void scalar_areas(const QuadColumns<T>& columns, size_t begin, double* out) {
+    for (size_t i = begin; i < columns.count; ++i) {
+        out[i] = quad_area(columns, i);
+    }
+}
+
+template<Scalar T>
+void scalar_centers(const QuadColumns<T>& columns, size_t begin, T* center_x, T* center_y) {
+    for (size_t i = begin; i < columns.count; ++i) {
+        T sum_x = T{};
+        T sum_y = T{};
+        for (size_t k = 0; k < 4; ++k) {
+            sum_x += columns.x[k][i];
+            sum_y += columns.y[k][i];
+        }
+        center_x[i] = sum_x / static_cast<T>(4);
+        center_y[i] = sum_y / static_cast<T>(4);
+    }
+}
+
+template<Scalar T>
+void scalar_polygon_moments(std::span<const Point<T>> vertices, size_t begin, PolygonMoments& moments) {
+    double origin_x = static_cast<double>(vertices[0].x());
+    double origin_y = static_cast<double>(vertices[0].y());
+    for (size_t i = begin; i < vertices.size(); ++i) {
+        const Point<T>& next = vertices[i + 1 < vertices.size() ? i + 1 : 0];
+        double ax = static_cast<double>(vertices[i].x()) - origin_x;
+        double ay = static_cast<double>(vertices[i].y()) - origin_y;
+        double bx = static_cast<double>(next.x()) - origin_x;
+        double by = static_cast<double>(next.y()) - origin_y;
+        double cross = ax * by - bx * ay;
+        moments.twice_area += cross;
+        moments.x += (ax + bx) * cross;
+        moments.y += (ay + by) * cross;
+    }
+}
+
+template<Scalar T>
+void scalar_affine(T* x, T* y, size_t begin, size_t count, const AffineTransform& transform) {
+    for (size_t i = begin; i < count; ++i) {
+        Point<T> point = transform.apply(Point<T>(x[i], y[i]));
+        x[i] = point.x();
+        y[i] = point.y();
+    }
+}
+
+#if FIGURES_SIMD_X86
+
+inline size_t sse2_centers(const QuadColumns<double>& columns, double* center_x, double* center_y) {
+    const __m128d quarter = _mm_set1_pd(0.25);
+    size_t i = 0;
+    for (; i + 2 <= columns.count; i += 2) {
+        __m128d sx = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_loadu_pd(columns.x[0] + i), _mm_loadu_pd(columns.x[1] + i)),
+                                           _mm_loadu_pd(columns.x[2] + i)), _mm_loadu_pd(columns.x[3] + i));
+        __m128d sy = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_loadu_pd(columns.y[0] + i), _mm_loadu_pd(columns.y[1] + i)),
+                                           _mm_loadu_pd(columns.y[2] + i)), _mm_loadu_pd(columns.y[3] + i));
+        _mm_storeu_pd(center_x + i, _mm_mul_pd(sx, quarter));
+        _mm_storeu_pd(center_y + i, _mm_mul_pd(sy, quarter));
+    }
+    return i;
+}
+
+inline size_t sse2_centers(const QuadColumns<float>& columns, float* center_x, float* center_y) {
+    const __m128 quarter = _mm_set1_ps(0.25f);
+    size_t i = 0;
+    for (; i + 4 <= columns.count; i += 4) {
+        __m128 sx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_loadu_ps(columns.x[0] + i), _mm_loadu_ps(columns.x[1] + i)),
+                                          _mm_loadu_ps(columns.x[2] + i)), _mm_loadu_ps(columns.x[3] + i));
+        __m128 sy = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_loadu_ps(columns.y[0] + i), _mm_loadu_ps(columns.y[1] + i)),
+                                          _mm_loadu_ps(columns.y[2] + i)), _mm_loadu_ps(columns.y[3] + i));
+        _mm_storeu_ps(center_x + i, _mm_mul_ps(sx, quarter));
+        _mm_storeu_ps(center_y + i, _mm_mul_ps(sy, quarter));
+    }
+    return i;
+}
+
+inline __m128i sse2_load_int(const int* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+inline __m128i sse2_quarter(__m128i sum) {
+    __m128i bias = _mm_srli_epi32(_mm_srai_epi32(sum, 31), 30);
+    return _mm_srai_epi32(_mm_add_epi32(sum, bias), 2);
+}
+
+inline size_t sse2_centers(const QuadColumns<int>& columns, int* center_x, int* center_y) {
+    size_t i = 0;
+    for (; i + 4 <= columns.count; i += 4) {
+        __m128i sx = _mm_add_epi32(_mm_add_epi32(_mm_add_epi32(sse2_load_int(columns.x[0] + i), sse2_load_int(columns.x[1] + i)),
+                                                 sse2_load_int(columns.x[2] + i)), sse2_load_int(columns.x[3] + i));
+        __m128i sy = _mm_add_epi32(_mm_add_epi32(_mm_add_epi32(sse2_load_int(columns.y[0] + i), sse2_load_int(columns.y[1] + i)),
+                                                 sse2_load_int(columns.y[2] + i)), sse2_load_int(columns.y[3] + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(center_x + i), sse2_quarter(sx));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(center_y + i), sse2_quarter(sy));
+    }
+    return i;
+}
+
+FIGURES_TARGET_AVX2 inline __m256d avx2_load(const double* p) { return _mm256_loadu_pd(p); }
+FIGURES_TARGET_AVX2 inline __m256d avx2_load(const float* p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+FIGURES_TARGET_AVX2 inline __m256d avx2_load(const int* p) { return _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))); }
+
+FIGURES_TARGET_AVX2 inline __m256d avx2_kind_mask(__m256i kinds, FigureKind kind) {
+    return _mm256_castsi256_pd(_mm256_cmpeq_epi64(kinds, _mm256_set1_epi64x(static_cast<std::int64_t>(kind))));
+}
+
+template<Vectorizable T>
+FIGURES_TARGET_AVX2 size_t avx2_areas(const QuadColumns<T>& columns, double* out) {
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    
+    size_t i = 0;
+    for (; i + 4 <= columns.count; i += 4) {
+        __m256d x0 = avx2_load(columns.x[0] + i), y0 = avx2_load(columns.y[0] + i);
+        __m256d x1 = avx2_load(columns.x[1] + i), y1 = avx2_load(columns.y[1] + i);
+        __m256d x2 = avx2_load(columns.x[2] + i), y2 = avx2_load(columns.y[2] + i);
+        __m256d x3 = avx2_load(columns.x[3] + i), y3 = avx2_load(columns.y[3] + i);
+        
+        std::int32_t packed_kinds;
+        std::memcpy(&packed_kinds, columns.kinds + i, sizeof(packed_kinds));
+        __m256i kinds = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(packed_kinds));
+        __m256d is_rectangle = avx2_kind_mask(kinds, FigureKind::Rectangle);
+        __m256d is_rhombus = avx2_kind_mask(kinds, FigureKind::Rhombus);
+        __m256d is_trapezoid = avx2_kind_mask(kinds, FigureKind::Trapezoid);
+        
+        __m256d dx1 = _mm256_sub_pd(x0, _mm256_blendv_pd(x1, x2, is_rhombus));
+        __m256d dy1 = _mm256_sub_pd(y0, _mm256_blendv_pd(y1, y2, is_rhombus));
+        __m256d dx2 = _mm256_sub_pd(_mm256_blendv_pd(x1, x2, is_trapezoid), _mm256_blendv_pd(x3, x2, is_rectangle));
+        __m256d dy2 = _mm256_sub_pd(_mm256_blendv_pd(y1, y2, is_trapezoid), _mm256_blendv_pd(y3, y2, is_rectangle));
+        
+        __m256d a = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(dx1, dx1), _mm256_mul_pd(dy1, dy1)));
+        __m256d b = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(dx2, dx2), _mm256_mul_pd(dy2, dy2)));
+        __m256d height = _mm256_andnot_pd(sign, _mm256_sub_pd(y0, y3));
+        
+        __m256d product = _mm256_mul_pd(a, b);
+        __m256d result = _mm256_blendv_pd(product, _mm256_mul_pd(product, half), is_rhombus);
+        result = _mm256_blendv_pd(result, _mm256_mul_pd(_mm256_mul_pd(_mm256_add_pd(a, b), height), half), is_trapezoid);
+        _mm256_storeu_pd(out + i, result);
+    }
+    return i;
+}
+
+FIGURES_TARGET_AVX2 inline size_t avx2_centers(const QuadColumns<double>& columns, double* center_x, double* center_y) {
+    const __m256d quarter = _mm256_set1_pd(0.25);
+    size_t i = 0;
+    for (; i + 4 <= columns.count; i += 4) {
+        __m256d sx = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(_mm256_loadu_pd(columns.x[0] + i), _mm256_loadu_pd(columns.x[1] + i)),
+                                                 _mm256_loadu_pd(columns.x[2] + i)), _mm256_loadu_pd(columns.x[3] + i));
+        __m256d sy = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(_mm256_loadu_pd(columns.y[0] + i), _mm256_loadu_pd(columns.y[1] + i)),
+                                                 _mm256_loadu_pd(columns.y[2] + i)), _mm256_loadu_pd(columns.y[3] + i));
+        _mm256_storeu_pd(center_x + i, _mm256_mul_pd(sx, quarter));
+        _mm256_storeu_pd(center_y + i, _mm256_mul_pd(sy, quarter));
+    }
+    return i;
+}
+
+FIGURES_TARGET_AVX2 inline size_t avx2_centers(const QuadColumns<float>& columns, float* center_x, float* center_y) {
+    const __m256 quarter = _mm256_set1_ps(0.25f);
+    size_t i = 0;
+    for (; i + 8 <= columns.count; i += 8) {
+        __m256 sx = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_loadu_ps(columns.x[0] + i), _mm256_loadu_ps(columns.x[1] + i)),
+                                                _mm256_loadu_ps(columns.x[2] + i)), _mm256_loadu_ps(columns.x[3] + i));
+        __m256 sy = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_loadu_ps(columns.y[0] + i), _mm256_loadu_ps(columns.y[1] + i)),
+                                                _mm256_loadu_ps(columns.y[2] + i)), _mm256_loadu_ps(columns.y[3] + i));
+        _mm256_storeu_ps(center_x + i, _mm256_mul_ps(sx, quarter));
+        _mm256_storeu_ps(center_y + i, _mm256_mul_ps(sy, quarter));
+    }
+    return i;
+}
+
+FIGURES_TARGET_AVX2 inline __m256i avx2_load_int(const int* p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+FIGURES_TARGET_AVX2 inline __m256i avx2_quarter(__m256i sum) {
+    __m256i bias = _mm256_srli_epi32(_mm256_srai_epi32(sum, 31), 30);
+    return _mm256_srai_epi32(_mm256_add_epi32(sum, bias), 2);
+}
+
+FIGURES_TARGET_AVX2 inline size_t avx2_centers(const QuadColumns<int>& columns, int* center_x, int* center_y) {
+    size_t i = 0;
+    for (; i + 8 <= columns.count; i += 8) {
+        __m256i sx = _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(avx2_load_int(columns.x[0] + i), avx2_load_int(columns.x[1] + i)),
+                                                       avx2_load_int(columns.x[2] + i)), avx2_load_int(columns.x[3] + i));
+        __m256i sy = _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(avx2_load_int(columns.y[0] + i), avx2_load_int(columns.y[1] + i)),
+                                                       avx2_load_int(columns.y[2] + i)), avx2_load_int(columns.y[3] + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(center_x + i), avx2_quarter(sx));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(center_y + i), avx2_quarter(sy));
+    }
+    return i;
+}
+
+FIGURES_TARGET_AVX2 inline size_t avx2_polygon_moments(std::span<const Point<double>> vertices, PolygonMoments& moments) {
+    static_assert(sizeof(Point<double>) == 2 * sizeof(double), "Point<double> must be two packed doubles");
+    const double* xy = reinterpret_cast<const double*>(vertices.data());
+    const __m256d origin = _mm256_setr_pd(xy[0], xy[1], xy[0], xy[1]);
+    
+    __m256d cross_sum = _mm256_setzero_pd();
+    __m256d moment_sum = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 2 < vertices.size(); i += 2) {
+        __m256d a = _mm256_sub_pd(_mm256_loadu_pd(xy + 2 * i), origin);
+        __m256d b = _mm256_sub_pd(_mm256_loadu_pd(xy + 2 * i + 2), origin);
+        __m256d products = _mm256_mul_pd(a, _mm256_permute_pd(b, 0b0101));
+        __m256d cross = _mm256_hsub_pd(products, products);
+        cross_sum = _mm256_add_pd(cross_sum, cross);
+        moment_sum = _mm256_add_pd(moment_sum, _mm256_mul_pd(_mm256_add_pd(a, b), cross));
+    }
+    
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, cross_sum);
+    moments.twice_area += lanes[0] + lanes[2];
+    _mm256_store_pd(lanes, moment_sum);
+    moments.x += lanes[0] + lanes[2];
+    moments.y += lanes[1] + lanes[3];
+    return i;
+}
+
+FIGURES_TARGET_AVX2 inline void avx2_affine_lanes(const AffineTransform& transform, __m256d& x, __m256d& y) {
+    __m256d nx = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(transform.a()), x),
+                                             _mm256_mul_pd(_mm256_set1_pd(transform.b()), y)),
+                               _mm256_set1_pd(transform.tx()));
+    __m256d ny = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(transform.c()), x),
+                                             _mm256_mul_pd(_mm256_set1_pd(transform.d()), y)),
+                               _mm256_set1_pd(transform.ty()));
+    x = nx;
+    y = ny;
+}
+
+FIGURES_TARGET_AVX2 inline size_t avx2_affine(double* x, double* y, size_t count, const AffineTransform& transform) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d px = _mm256_loadu_pd(x + i);
+        __m256d py = _mm256_loadu_pd(y + i);
+        avx2_affine_lanes(transform, px, py);
+        _mm256_storeu_pd(x + i, px);
+        _mm256_storeu_pd(y + i, py);
+    }
+    return i;
+}
+
+FIGURES_TARGET_AVX2 inline size_t avx2_affine(float* x, float* y, size_t count, const AffineTransform& transform) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d px = _mm256_cvtps_pd(_mm_loadu_ps(x + i));
+        __m256d py = _mm256_cvtps_pd(_mm_loadu_ps(y + i));
+        avx2_affine_lanes(transform, px, py);
+        _mm_storeu_ps(x + i, _mm256_cvtpd_ps(px));
+        _mm_storeu_ps(y + i, _mm256_cvtpd_ps(py));
+    }
+    return i;
+}
+
+#endif
+
+}
+
+template<Scalar T>
+PolygonMoments polygon_moments(std::span<const Point<T>> vertices, SimdLevel level = detected_simd_level()) {
+    PolygonMoments moments;
+    if (vertices.size() < 3) {
+        return moments;
+    }
+    
+    level = std::min(level, detected_simd_level());
+    size_t done = 0;
+#if FIGURES_SIMD_X86
+    if constexpr (std::is_same_v<T, double>) {
+        if (level == SimdLevel::AVX2) {
+            done = simd_detail::avx2_polygon_moments(vertices, moments);
+        }
+    }
+#endif
+    simd_detail::scalar_polygon_moments(vertices, done, moments);
+    return moments;
+}
+
+template<Scalar T>
+void batch_affine(T* x, T* y, size_t count, const AffineTransform& transform, SimdLevel level = detected_simd_level()) {
+    level = std::min(level, detected_simd_level());
+    size_t done = 0;
+#if FIGURES_SIMD_X86
+    if constexpr (std::is_floating_point_v<T> && simd_detail::Vectorizable<T>) {
+        if (level == SimdLevel::AVX2) {
+            done = simd_detail::avx2_affine(x, y, count, transform);
+        }
+    }
+#endif
+    simd_detail::scalar_affine(x, y, done, count, transform);
+}
+
+template<Scalar T>
+void batch_areas(const QuadColumns<T>& columns, double* out, SimdLevel level = detected_simd_level()) {
+    level = std::min(level, detected_simd_level());
+    size_t done = 0;
+#if FIGURES_SIMD_X86
+    if constexpr (simd_detail::Vectorizable<T> && !IntegralScalar<T>) {
+        if (level == SimdLevel::AVX2) {
+            done = simd_detail::avx2_areas(columns, out);
+        }
+    }
+#endif
+    simd_detail::scalar_areas(columns, done, out);
+}
+
+template<Scalar T>
+void batch_centers(const QuadColumns<T>& columns, T* center_x, T* center_y, SimdLevel level = detected_simd_level()) {
+    level = std::min(level, detected_simd_level());
+    size_t done = 0;
+#if FIGURES_SIMD_X86
+    if constexpr (simd_detail::Vectorizable<T>) {
+        if (level == SimdLevel::AVX2) {
+            done = simd_detail::avx2_centers(columns, center_x, center_y);
+        } else if (level == SimdLevel::SSE2) {
+            done = simd_detail::sse2_centers(columns, center_x, center_y);
+        }
+    }
+#endif
+    simd_detail::scalar_centers(columns, done, center_x, center_y);
+}
+
+template<Scalar T>
+double batch_total_area(const QuadColumns<T>& columns, SimdLevel level = detected_simd_level()) {
+    constexpr size_t block = 256;
+    double areas[block];
+    double total = 0.0;
+    
+    for (size_t begin = 0; begin < columns.count; begin += block) {
+        QuadColumns<T> slice = columns.slice(begin, std::min(block, columns.count - begin));
+        
+        batch_areas(slice, areas, level);
+        for (size_t i = 0; i < slice.count; ++i) {
+            total += areas[i];
+        }
+    }
+    return total;
+}
@@ -0,0 +1,267 @@
+#pragma once
+#include "Array.h"
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <stdexcept>
+#include <iostream>
+
+template<class T, size_t N, class BoundsPolicy = CheckedBounds>
+class SmallArray {
+    static_assert(N > 0, "SmallArray needs at least one inline slot");
+
+private:
+    alignas(T) unsigned char inline_storage_[N * sizeof(T)];
+    T* data_;
+    size_t size_;
+    size_t capacity_;
+    
+    T* inline_data() {
+        return std::launder(reinterpret_cast<T*>(inline_storage_));
+    }
+    
+    bool is_inline() const {
+        return data_ == reinterpret_cast<const T*>(inline_storage_);
+    }
+    
+    static void relocate(T* from, size_t count, T* to) {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(from, count, to);
+        } else {
+            std::uninitialized_copy_n(from, count, to);
+        }
+    }
+    
+    void release_heap() {
+        if (!is_inline()) {
+            std::allocator<T>().deallocate(data_, capacity_);
+        }
+        data_ = inline_data();
+        capacity_ = N;
+    }
+    
+    void reallocate(size_t new_capacity) {
+        T* new_data = new_capacity <= N ? inline_data() : std::allocator<T>().allocate(new_capacity);
+        if (new_data == data_) {
+            return;
+        }
+        
+        try {
+            relocate(data_, size_, new_data);
+        } catch (...) {
+            if (new_data != inline_data()) {
+                std::allocator<T>().deallocate(new_data, new_capacity);
+            }
+            throw;
+        }
+        
+        std::destroy_n(data_, size_);
+        release_heap();
+        data_ = new_data;
+        capacity_ = new_data == inline_data() ? N : new_capacity;
+    }
+    
+    void take(SmallArray& other) {
+        if (other.is_inline()) {
+            std::uninitialized_move_n(other.data_, other.size_, data_);
+            size_ = other.size_;
+            other.clear();
+        } else {
+            data_ = std::exchange(other.data_, other.inline_data());
+            size_ = std::exchange(other.size_, 0);
+            capacity_ = std::exchange(other.capacity_, N);
+        }
+    }
+
+public:
+    using iterator = typename Array<T>::iterator;
+    using const_iterator = typename Array<T>::const_iterator;
+    
+    static constexpr size_t inline_capacity = N;
+    
+    SmallArray() : data_(inline_data()), size_(0), capacity_(N) {}
+    
+    SmallArray(const SmallArray& other) : SmallArray() {
+        reserve(other.size_);
+        std::uninitialized_copy_n(other.data_, other.size_, data_);
+        size_ = other.size_;
+    }
+    
+    SmallArray(SmallArray&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : SmallArray() {
+        take(other);
+    }
+    
+    ~SmallArray() {
+        std::destroy_n(data_, size_);
+        release_heap();
+    }
+    
+    SmallArray& operator=(const SmallArray& other) {
+        if (this != &other) {
+            SmallArray copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+    
+    SmallArray& operator=(SmallArray&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            release_heap();
+            take(other);
+        }
+        return *this;
+    }
+    
+    bool is_small() const {
+        return is_inline();
+    }
+    
+    template<class... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ < capacity_) {
+            std::construct_at(data_ + size_, std::forward<Args>(args)...);
+            return data_[size_++];
+        }
+        
+        size_t new_capacity = capacity_ * 2;
+        T* new_data = std::allocator<T>().allocate(new_capacity);
+        try {
+            std::construct_at(new_data + size_, std::forward<Args>(args)...);
+        } catch (...) {
+            std::allocator<T>().deallocate(new_data, new_capacity);
+            throw;
+        }
+        
+        try {
+            relocate(data_, size_, new_data);
+        } catch (...) {
+            std::destroy_at(new_data + size_);
+            std::allocator<T>().deallocate(new_data, new_capacity);
+            throw;
+        }
+        
+        std::destroy_n(data_, size_);
+        release_heap();
+        data_ = new_data;
+        capacity_ = new_capacity;
+        return data_[size_++];
+    }
+    
+    void push_back(const T& item) {
+        emplace_back(item);
+    }
+    
+    void push_back(T&& item) {
+        emplace_back(std::move(item));
+    }
+    
+    void pop_back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Array is empty");
+        }
+        std::destroy_at(data_ + --size_);
+    }
+    
+    void reserve(size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            reallocate(new_capacity);
+        }
+    }
+    
+    void shrink_to_fit() {
+        if (capacity_ > size_ && !is_inline()) {
+            reallocate(size_);
+        }
+    }
+    
+    void remove(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        
+        for (size_t i = index; i < size_ - 1; ++i) {
+            data_[i] = std::move(data_[i + 1]);
+        }
+        
+        std::destroy_at(data_ + --size_);
+    }
+    
+    T& operator[](size_t index) {
+        BoundsPolicy::check(index, size_);
+        return data_[index];
+    }
+    
+    const T& operator[](size_t index) const {
+        BoundsPolicy::check(index, size_);
+        return data_[index];
+    }
+    
+    size_t size() const {
+        return size_;
+    }
+    
+    size_t capacity() const {
+        return capacity_;
+    }
+    
+    bool empty() const {
+        return size_ == 0;
+    }
+    
+    void clear() {
+        std::destroy_n(data_, size_);
+        size_ = 0;
+    }
+    
+    T& at(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return data_[index];
+    }
+    
+    const T& at(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return data_[index];
+    }
+    
+    iterator begin() {
+        return iterator(data_);
+    }
+    
+    iterator end() {
+        return iterator(data_ + size_);
+    }
+    
+    const_iterator begin() const {
+        return const_iterator(data_);
+    }
+    
+    const_iterator end() const {
+        return const_iterator(data_ + size_);
+    }
+    
+    const_iterator cbegin() const {
+        return begin();
+    }
+    
+    const_iterator cend() const {
+        return end();
+    }
+    
+    friend std::ostream& operator<<(std::ostream& os, const SmallArray& arr) {
+        os << "[";
+        for (size_t i = 0; i < arr.size_; ++i) {
+            os << arr.data_[i];
+            if (i < arr.size_ - 1) {
+                os << ", ";
+            }
+        }
+        os << "]";
+        return os;
+    }
+};
@@ -0,0 +1,305 @@
+#pragma once
+#include "Point.h"
+#include "BoundingBox.h"
+#include "Figure.h"
+#include "Array.h"
+#include "FigureStore.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+struct FigurePair {
+    size_t first = 0;
+    size_t second = 0;
+    
+    bool operator==(const FigurePair& other) const {
+        return first == other.first && second == other.second;
+    }
+    
+    bool operator!=(const FigurePair& other) const {
+        return !(*this == other);
+    }
+    
+    bool operator<(const FigurePair& other) const {
+        return first < other.first || (first == other.first && second < other.second);
+    }
+};
+
+namespace sweep_and_prune_detail {
+
+#if FIGURES_SIMD_X86
+
+FIGURES_TARGET_AVX2 inline size_t avx2_overlap_mask(const double* sweep_min, const double* cross_min,
+                                                    const double* cross_max, size_t count, double sweep_max,
+                                                    double query_min, double query_max, std::uint64_t& hits) {
+    const __m256d limit = _mm256_set1_pd(sweep_max);
+    const __m256d lower = _mm256_set1_pd(query_min);
+    const __m256d upper = _mm256_set1_pd(query_max);
+    size_t k = 0;
+    for (; k + 4 <= count; k += 4) {
+        __m256d overlap = _mm256_and_pd(_mm256_cmp_pd(_mm256_loadu_pd(sweep_min + k), limit, _CMP_LE_OQ),
+                                        _mm256_and_pd(_mm256_cmp_pd(_mm256_loadu_pd(cross_min + k), upper, _CMP_LE_OQ),
+                                                      _mm256_cmp_pd(_mm256_loadu_pd(cross_max + k), lower, _CMP_GE_OQ)));
+        hits |= static_cast<std::uint64_t>(_mm256_movemask_pd(overlap)) << k;
+    }
+    return k;
+}
+
+#endif
+
+}
+
+template<Scalar T>
+class SweepAndPrune {
+public:
+    static constexpr size_t default_block_size = 1024;
+    static constexpr size_t max_moves_per_figure = 32;
+
+private:
+    std::vector<BoundingBox<T>> boxes_;
+    std::vector<size_t> order_;
+    std::vector<T> sweep_min_;
+    std::vector<T> sweep_max_;
+    std::vector<T> cross_min_;
+    std::vector<T> cross_max_;
+    bool sweep_y_ = false;
+    size_t last_moves_ = 0;
+    bool last_resorted_ = false;
+    
+    T sweep_key(size_t id) const {
+        return sweep_y_ ? boxes_[id].min_y() : boxes_[id].min_x();
+    }
+    
+    bool before(size_t a, size_t b) const {
+        T a_key = sweep_key(a);
+        T b_key = sweep_key(b);
+        return a_key < b_key || (a_key == b_key && a < b);
+    }
+    
+    void choose_axis() {
+        double spread_x = 0.0;
+        double spread_y = 0.0;
+        if (!boxes_.empty()) {
+            BoundingBox<T> bounds = boxes_[0];
+            double extent_x = 0.0;
+            double extent_y = 0.0;
+            for (const BoundingBox<T>& box : boxes_) {
+                bounds.expand(box.min());
+                bounds.expand(box.max());
+                extent_x += static_cast<double>(box.width());
+                extent_y += static_cast<double>(box.height());
+            }
+            spread_x = static_cast<double>(bounds.width()) * static_cast<double>(boxes_.size()) / std::max(extent_x, 1e-300);
+            spread_y = static_cast<double>(bounds.height()) * static_cast<double>(boxes_.size()) / std::max(extent_y, 1e-300);
+        }
+        sweep_y_ = spread_y > spread_x;
+    }
+    
+    bool insertion_sort() {
+        size_t budget = order_.size() * max_moves_per_figure;
+        last_moves_ = 0;
+        for (size_t i = 1; i < order_.size(); ++i) {
+            size_t id = order_[i];
+            size_t j = i;
+            for (; j > 0 && before(id, order_[j - 1]); --j) {
+                order_[j] = order_[j - 1];
+            }
+            order_[j] = id;
+            last_moves_ += i - j;
+            if (last_moves_ > budget) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    void sort_order() {
+        last_resorted_ = order_.size() != boxes_.size() || !insertion_sort();
+        if (last_resorted_) {
+            choose_axis();
+            order_.resize(boxes_.size());
+            std::iota(order_.begin(), order_.end(), size_t(0));
+            std::sort(order_.begin(), order_.end(), [this](size_t a, size_t b) { return before(a, b); });
+        }
+        
+        sweep_min_.resize(order_.size());
+        sweep_max_.resize(order_.size());
+        cross_min_.resize(order_.size());
+        cross_max_.resize(order_.size());
+        for (size_t i = 0; i < order_.size(); ++i) {
+            const BoundingBox<T>& box = boxes_[order_[i]];
+            sweep_min_[i] = sweep_y_ ? box.min_y() : box.min_x();
+            sweep_max_[i] = sweep_y_ ? box.max_y() : box.max_x();
+            cross_min_[i] = sweep_y_ ? box.min_x() : box.min_y();
+            cross_max_[i] = sweep_y_ ? box.max_x() : box.max_y();
+        }
+    }
+    
+    std::uint64_t overlap_mask(size_t first, size_t count, T sweep_max, T cross_min, T cross_max) const {
+        size_t k = 0;
+        std::uint64_t hits = 0;
+#if FIGURES_SIMD_X86
+        if constexpr (std::is_same_v<T, double>) {
+            if (detected_simd_level() == SimdLevel::AVX2) {
+                k = sweep_and_prune_detail::avx2_overlap_mask(sweep_min_.data() + first, cross_min_.data() + first,
+                                                              cross_max_.data() + first, count, sweep_max,
+                                                              cross_min, cross_max, hits);
+            }
+        }
+#endif
+        for (; k < count; ++k) {
+            bool overlap = (sweep_min_[first + k] <= sweep_max) & (cross_min_[first + k] <= cross_max) &
+                           (cross_max_[first + k] >= cross_min);
+            hits |= static_cast<std::uint64_t>(overlap) << k;
+        }
+        return hits;
+    }
+    
+    template<class Filter>
+    void sweep(size_t begin, size_t end, Filter& filter, std::vector<FigurePair>& out) const {
+        size_t count = order_.size();
+        size_t last = begin;
+        for (size_t i = begin; i < end; ++i) {
+            T sweep_max = sweep_max_[i];
+            last = std::max(last, i + 1);
+            while (last < count && sweep_min_[last] <= sweep_max) {
+                ++last;
+            }
+            
+            for (size_t first = i + 1; first < last; first += 64) {
+                std::uint64_t hits = overlap_mask(first, std::min<size_t>(64, last - first), sweep_max,
+                                                  cross_min_[i], cross_max_[i]);
+                for (; hits != 0; hits &= hits - 1) {
+                    size_t j = first + static_cast<size_t>(std::countr_zero(hits));
+                    FigurePair pair{std::min(order_[i], order_[j]), std::max(order_[i], order_[j])};
+                    if (filter(pair.first, pair.second)) {
+                        out.push_back(pair);
+                    }
+                }
+            }
+        }
+    }
+
+public:
+    SweepAndPrune() = default;
+    
+    template<class... Policies>
+    explicit SweepAndPrune(const Array<std::shared_ptr<Figure<T>>, Policies...>& figures) {
+        update(figures);
+    }
+    
+    explicit SweepAndPrune(const FigureStore<T>& store) {
+        update(store);
+    }
+    
+    SweepAndPrune(const SweepAndPrune& other) = default;
+    
+    SweepAndPrune(SweepAndPrune&& other) noexcept = default;
+    
+    SweepAndPrune& operator=(const SweepAndPrune& other) = default;
+    
+    SweepAndPrune& operator=(SweepAndPrune&& other) noexcept = default;
+    
+    void update(std::span<const BoundingBox<T>> boxes) {
+        boxes_.assign(boxes.begin(), boxes.end());
+        sort_order();
+    }
+    
+    template<class... Policies>
+    void update(const Array<std::shared_ptr<Figure<T>>, Policies...>& figures) {
+        boxes_.resize(figures.size());
+        for (size_t i = 0; i < figures.size(); ++i) {
+            boxes_[i] = figures[i]->bounding_box();
+        }
+        sort_order();
+    }
+    
+    void update(const FigureStore<T>& store) {
+        boxes_.resize(store.size());
+        for (size_t i = 0; i < store.size(); ++i) {
+            boxes_[i] = store.bounding_box(i);
+        }
+        sort_order();
+    }
+    
+    size_t size() const {
+        return boxes_.size();
+    }
+    
+    bool empty() const {
+        return boxes_.empty();
+    }
+    
+    const BoundingBox<T>& box(size_t id) const {
+        if (id >= boxes_.size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        return boxes_[id];
+    }
+    
+    size_t last_moves() const {
+        return last_moves_;
+    }
+    
+    bool last_resorted() const {
+        return last_resorted_;
+    }
+    
+    template<class Filter>
+    std::vector<FigurePair> pairs_if(Filter&& filter) const {
+        std::vector<FigurePair> result;
+        sweep(0, order_.size(), filter, result);
+        return result;
+    }
+    
+    template<class Filter>
+    std::vector<FigurePair> pairs_if(ThreadPool& pool, Filter&& filter, size_t block_size = default_block_size) const {
+        block_size = std::max<size_t>(1, block_size);
+        size_t blocks = (order_.size() + block_size - 1) / block_size;
+        std::vector<std::vector<FigurePair>> partials(blocks);
+        
+        pool.parallel_for(blocks, [&](size_t block) {
+            size_t begin = block * block_size;
+            sweep(begin, std::min(order_.size(), begin + block_size), filter, partials[block]);
+        });
+        
+        size_t total = 0;
+        for (const auto& partial : partials) {
+            total += partial.size();
+        }
+        std::vector<FigurePair> result;
+        result.reserve(total);
+        for (const auto& partial : partials) {
+            result.insert(result.end(), partial.begin(), partial.end());
+        }
+        return result;
+    }
+    
+    std::vector<FigurePair> candidate_pairs() const {
+        return pairs_if([](size_t, size_t) { return true; });
+    }
+    
+    std::vector<FigurePair> candidate_pairs(ThreadPool& pool, size_t block_size = default_block_size) const {
+        return pairs_if(pool, [](size_t, size_t) { return true; }, block_size);
+    }
+    
+    void clear() {
+        boxes_.clear();
+        order_.clear();
+        sweep_min_.clear();
+        sweep_max_.clear();
+        cross_min_.clear();
+        cross_max_.clear();
+        sweep_y_ = false;
+        last_moves_ = 0;
+        last_resorted_ = false;
+    }
+};
@@ -0,0 +1,154 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+private:
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+    
+    std::vector<std::unique_ptr<WorkQueue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<std::uint32_t> wake_epoch_{0};
+    std::atomic<size_t> next_queue_{0};
+    std::atomic<bool> stopping_{false};
+    
+    static inline thread_local const ThreadPool* current_pool_ = nullptr;
+    static inline thread_local size_t current_index_ = 0;
+    
+    size_t home_queue() const {
+        return current_pool_ == this ? current_index_ : next_queue_.load(std::memory_order_relaxed) % queues_.size();
+    }
+    
+    void push(std::function<void()> task) {
+        size_t index = current_pool_ == this 
+            ? current_index_ 
+            : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+        {
+            std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+            queues_[index]->tasks.push_back(std::move(task));
+        }
+        wake_epoch_.fetch_add(1, std::memory_order_release);
+        wake_epoch_.notify_one();
+    }
+    
+    bool try_run_one(size_t home) {
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(queues_[home]->mutex);
+            if (!queues_[home]->tasks.empty()) {
+                task = std::move(queues_[home]->tasks.back());
+                queues_[home]->tasks.pop_back();
+            }
+        }
+        
+        for (size_t offset = 1; !task && offset < queues_.size(); ++offset) {
+            WorkQueue& victim = *queues_[(home + offset) % queues_.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+            }
+        }
+        
+        if (!task) {
+            return false;
+        }
+        
+        task();
+        return true;
+    }
+    
+    void worker_loop(size_t index) {
+        current_pool_ = this;
+        current_index_ = index;
+        
+        while (true) {
+            std::uint32_t epoch = wake_epoch_.load(std::memory_order_acquire);
+            if (try_run_one(index)) {
+                continue;
+            }
+            if (stopping_.load(std::memory_order_acquire)) {
+                return;
+            }
+            wake_epoch_.wait(epoch, std::memory_order_acquire);
+        }
+    }
+
+public:
+    explicit ThreadPool(size_t thread_count = std::max(1u, std::thread::hardware_concurrency())) {
+        thread_count = std::max<size_t>(1, thread_count);
+        
+        queues_.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; ++i) {
+            queues_.push_back(std::make_unique<WorkQueue>());
+        }
+        
+        threads_.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; ++i) {
+            threads_.emplace_back([this, i] { worker_loop(i); });
+        }
+    }
+    
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    
+    ~ThreadPool() {
+        stopping_.store(true, std::memory_order_release);
+        wake_epoch_.fetch_add(1, std::memory_order_release);
+        wake_epoch_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+    
+    size_t thread_count() const {
+        return threads_.size();
+    }
+    
+    template<class Body>
+    void parallel_for(size_t count, Body&& body) {
+        if (count == 0) {
+            return;
+        }
+        
+        std::atomic<size_t> remaining{count};
+        std::exception_ptr error;
+        std::mutex error_mutex;
+        
+        for (size_t i = 0; i < count; ++i) {
+            push([&, i] {
+                try {
+                    body(i);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                remaining.fetch_sub(1, std::memory_order_release);
+            });
+        }
+        
+        size_t home = home_queue();
+        while (remaining.load(std::memory_order_acquire) != 0) {
+            if (!try_run_one(home)) {
+                std::this_thread::yield();
+            }
+        }
+        
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+};
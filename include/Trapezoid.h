@@ -1,10 +1,11 @@
 #pragma once
-#include "Figure.h"
+#include "FixedFigure.h"
+#include "TrapezoidValue.h"
 #include <stdexcept>
 #include <cmath>
 
 template<Scalar T>
-class Trapezoid : public Figure<T> {
+class Trapezoid : public FixedFigure<T, 4> {
 public:
     Trapezoid() = default;
     
@@ -17,89 +18,98 @@ public:
         T half_base1 = base1 / 2;
         T half_base2 = base2 / 2;
         
-        this->vertices_.push_back(std::make_unique<Point<T>>(center.x() - half_base1, center.y() - half_height));
-        this->vertices_.push_back(std::make_unique<Point<T>>(center.x() + half_base1, center.y() - half_height));
-        this->vertices_.push_back(std::make_unique<Point<T>>(center.x() + half_base2, center.y() + half_height));
-        this->vertices_.push_back(std::make_unique<Point<T>>(center.x() - half_base2, center.y() + half_height));
+        this->add_vertex(center.x() - half_base1, center.y() - half_height);
+        this->add_vertex(center.x() + half_base1, center.y() - half_height);
+        this->add_vertex(center.x() + half_base2, center.y() + half_height);
+        this->add_vertex(center.x() - half_base2, center.y() + half_height);
     }
     
     Trapezoid(T x1, T y1, T x2, T y2, T x3, T y3, T x4, T y4) {
-        this->vertices_.push_back(std::make_unique<Point<T>>(x1, y1));
-        this->vertices_.push_back(std::make_unique<Point<T>>(x2, y2));
-        this->vertices_.push_back(std::make_unique<Point<T>>(x3, y3));
-        this->vertices_.push_back(std::make_unique<Point<T>>(x4, y4));
+        this->add_vertex(x1, y1);
+        this->add_vertex(x2, y2);
+        this->add_vertex(x3, y3);
+        this->add_vertex(x4, y4);
         
         if (!is_valid_trapezoid()) {
             throw std::invalid_argument("Points do not form a valid trapezoid");
         }
     }
     
-    Trapezoid(const Trapezoid& other) : Figure<T>(other) {}
+    explicit Trapezoid(const TrapezoidValue<T>& value) {
+        for (const Point<T>& vertex : value.vertices()) {
+            this->add_vertex(vertex.x(), vertex.y());
+        }
+    }
+    
+    Trapezoid(const Trapezoid& other) : FixedFigure<T, 4>(other) {}
     
-    Trapezoid(Trapezoid&& other) noexcept : Figure<T>(std::move(other)) {}
+    Trapezoid(Trapezoid&& other) noexcept : FixedFigure<T, 4>(std::move(other)) {}
     
     Trapezoid& operator=(const Trapezoid& other) {
         if (this != &other) {
-            Figure<T>::operator=(other);
+            FixedFigure<T, 4>::operator=(other);
         }
         return *this;
     }
     
     Trapezoid& operator=(Trapezoid&& other) noexcept {
         if (this != &other) {
-            Figure<T>::operator=(std::move(other));
+            FixedFigure<T, 4>::operator=(std::move(other));
         }
         return *this;
     }
     
-    double area() const override {
-        if (this->vertices_.size() != 4) {
-            return 0.0;
+    TrapezoidValue<T> value() const {
+        if (this->count_ != 4) {
+            return TrapezoidValue<T>();
         }
-        
-        double base1 = this->vertices_[0]->distance(*this->vertices_[1]);
-        double base2 = this->vertices_[2]->distance(*this->vertices_[3]);
-        double height = std::abs(this->vertices_[0]->y() - this->vertices_[3]->y());
-        
-        return (base1 + base2) * height / 2.0;
+        return TrapezoidValue<T>::from_validated(this->vertices_);
     }
     
     T base1() const {
-        if (this->vertices_.size() != 4) {
+        if (this->count_ != 4) {
             return T{};
         }
-        return static_cast<T>(this->vertices_[0]->distance(*this->vertices_[1]));
+        return static_cast<T>(this->vertices_[0].distance(this->vertices_[1]));
     }
     
     T base2() const {
-        if (this->vertices_.size() != 4) {
+        if (this->count_ != 4) {
             return T{};
         }
-        return static_cast<T>(this->vertices_[2]->distance(*this->vertices_[3]));
+        return static_cast<T>(this->vertices_[2].distance(this->vertices_[3]));
     }
     
     T height() const {
-        if (this->vertices_.size() != 4) {
+        if (this->count_ != 4) {
             return T{};
         }
-        return static_cast<T>(std::abs(this->vertices_[0]->y() - this->vertices_[3]->y()));
+        return static_cast<T>(std::abs(this->vertices_[0].y() - this->vertices_[3].y()));
     }
 
-private:
-    bool is_valid_trapezoid() const {
-        if (this->vertices_.size() != 4) {
-            return false;
+protected:
+    bool has_valid_shape() const override {
+        return is_valid_trapezoid();
+    }
+    
+    double compute_area() const override {
+        if (this->count_ != 4) {
+            return 0.0;
         }
         
-        const double eps = 1e-9;
-        
-        T y1 = this->vertices_[0]->y();
-        T y2 = this->vertices_[1]->y();
-        T y3 = this->vertices_[2]->y();
-        T y4 = this->vertices_[3]->y();
-        
-        bool parallel_bases = (std::abs(y1 - y2) < eps) && (std::abs(y3 - y4) < eps);
-        
-        return parallel_bases && (std::abs(y1 - y3) > eps);
+        if constexpr (IntegralScalar<T>) {
+            return exact_area<T>(this->vertices());
+        } else {
+            double base1 = this->vertices_[0].distance(this->vertices_[1]);
+            double base2 = this->vertices_[2].distance(this->vertices_[3]);
+            double height = std::abs(this->vertices_[0].y() - this->vertices_[3].y());
+            
+            return (base1 + base2) * height / 2.0;
+        }
+    }
+
+private:
+    bool is_valid_trapezoid() const {
+        return this->count_ == 4 && TrapezoidValue<T>::is_valid(this->vertices_);
     }
 };
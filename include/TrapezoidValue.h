@@ -0,0 +1,89 @@
+#pragma once
+#include "QuadValue.h"
+#include "ExactGeometry.h"
+#include "FigureKind.h"
+#include <stdexcept>
+
+template<Scalar T>
+class TrapezoidValue : public QuadValue<T> {
+public:
+    using typename QuadValue<T>::Vertices;
+    
+    static constexpr FigureKind kind = FigureKind::Trapezoid;
+    
+    constexpr TrapezoidValue() = default;
+    
+    constexpr TrapezoidValue(const Point<T>& center, T base1, T base2, T height) {
+        if (base1 <= 0 || base2 <= 0 || height <= 0) {
+            throw std::invalid_argument("All dimensions must be positive");
+        }
+        
+        T half_height = height / 2;
+        T half_base1 = base1 / 2;
+        T half_base2 = base2 / 2;
+        
+        this->vertices_ = {Point<T>(center.x() - half_base1, center.y() - half_height),
+                           Point<T>(center.x() + half_base1, center.y() - half_height),
+                           Point<T>(center.x() + half_base2, center.y() + half_height),
+                           Point<T>(center.x() - half_base2, center.y() + half_height)};
+    }
+    
+    constexpr TrapezoidValue(T x1, T y1, T x2, T y2, T x3, T y3, T x4, T y4)
+        : QuadValue<T>(x1, y1, x2, y2, x3, y3, x4, y4) {
+        if (!is_valid(this->vertices_)) {
+            throw std::invalid_argument("Points do not form a valid trapezoid");
+        }
+    }
+    
+    constexpr TrapezoidValue(const TrapezoidValue& other) = default;
+    
+    constexpr TrapezoidValue(TrapezoidValue&& other) noexcept = default;
+    
+    constexpr TrapezoidValue& operator=(const TrapezoidValue& other) = default;
+    
+    constexpr TrapezoidValue& operator=(TrapezoidValue&& other) noexcept = default;
+    
+    static constexpr TrapezoidValue from_validated(const Vertices& vertices) {
+        return TrapezoidValue(vertices);
+    }
+    
+    static constexpr bool is_valid(const Vertices& v) {
+        using quad_value_detail::absolute_tolerance;
+        
+        auto gap = [](T a, T b) { return point_detail::constexpr_abs(static_cast<double>(a) - static_cast<double>(b)); };
+        
+        bool parallel_bases = gap(v[0].y(), v[1].y()) < absolute_tolerance && gap(v[2].y(), v[3].y()) < absolute_tolerance;
+        
+        double base1 = static_cast<double>(v[1].x()) - static_cast<double>(v[0].x());
+        double base2 = static_cast<double>(v[3].x()) - static_cast<double>(v[2].x());
+        
+        return parallel_bases && gap(v[0].y(), v[2].y()) > absolute_tolerance && base1 * base2 <= 0.0;
+    }
+    
+    constexpr T base1() const {
+        return static_cast<T>(this->vertices_[0].distance(this->vertices_[1]));
+    }
+    
+    constexpr T base2() const {
+        return static_cast<T>(this->vertices_[2].distance(this->vertices_[3]));
+    }
+    
+    constexpr T height() const {
+        return static_cast<T>(point_detail::constexpr_abs(this->vertices_[0].y() - this->vertices_[3].y()));
+    }
+    
+    constexpr double area() const {
+        if constexpr (IntegralScalar<T>) {
+            return exact_area<T>(this->vertices_);
+        } else {
+            double base1 = this->vertices_[0].distance(this->vertices_[1]);
+            double base2 = this->vertices_[2].distance(this->vertices_[3]);
+            double height = point_detail::constexpr_abs(this->vertices_[0].y() - this->vertices_[3].y());
+            
+            return (base1 + base2) * height / 2.0;
+        }
+    }
+
+private:
+    constexpr explicit TrapezoidValue(const Vertices& vertices) : QuadValue<T>(vertices) {}
+};
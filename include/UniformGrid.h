@@ -0,0 +1,208 @@
+#pragma once
+#include "Point.h"
+#include "BoundingBox.h"
+#include "Figure.h"
+#include "Array.h"
+#include "FigureStore.h"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+template<Scalar T>
+class UniformGrid {
+public:
+    struct Entry {
+        BoundingBox<T> box;
+        size_t value;
+    };
+
+private:
+    BoundingBox<T> bounds_;
+    size_t columns_ = 1;
+    size_t rows_ = 1;
+    double inverse_cell_width_ = 0.0;
+    double inverse_cell_height_ = 0.0;
+    std::vector<std::vector<Entry>> cells_;
+    size_t size_ = 0;
+    
+    static size_t cell_coordinate(T value, T min, double inverse_cell, size_t cells) {
+        double offset = (static_cast<double>(value) - static_cast<double>(min)) * inverse_cell;
+        if (!(offset > 0.0)) {
+            return 0;
+        }
+        return offset >= static_cast<double>(cells) ? cells - 1 : static_cast<size_t>(offset);
+    }
+    
+    size_t column_of(T x) const {
+        return cell_coordinate(x, bounds_.min_x(), inverse_cell_width_, columns_);
+    }
+    
+    size_t row_of(T y) const {
+        return cell_coordinate(y, bounds_.min_y(), inverse_cell_height_, rows_);
+    }
+    
+    void reset(const BoundingBox<T>& bounds, size_t columns, size_t rows) {
+        if (columns == 0 || rows == 0) {
+            throw std::invalid_argument("Grid must have at least one cell");
+        }
+        
+        bounds_ = bounds;
+        columns_ = columns;
+        rows_ = rows;
+        inverse_cell_width_ = bounds.width() > T{} ? static_cast<double>(columns) / static_cast<double>(bounds.width()) : 0.0;
+        inverse_cell_height_ = bounds.height() > T{} ? static_cast<double>(rows) / static_cast<double>(bounds.height()) : 0.0;
+        cells_.assign(columns * rows, {});
+        size_ = 0;
+    }
+    
+    void build(const std::vector<Entry>& entries) {
+        if (entries.empty()) {
+            return;
+        }
+        
+        BoundingBox<T> bounds = entries[0].box;
+        for (const Entry& entry : entries) {
+            bounds.expand(entry.box);
+        }
+        
+        size_t side = std::max<size_t>(1, static_cast<size_t>(std::sqrt(static_cast<double>(entries.size()))));
+        reset(bounds, side, side);
+        for (const Entry& entry : entries) {
+            insert(entry.value, entry.box);
+        }
+    }
+
+public:
+    UniformGrid() : cells_(1) {}
+    
+    UniformGrid(const BoundingBox<T>& bounds, size_t columns, size_t rows) {
+        reset(bounds, columns, rows);
+    }
+    
+    template<class... Policies>
+    explicit UniformGrid(const Array<std::shared_ptr<Figure<T>>, Policies...>& figures) : cells_(1) {
+        std::vector<Entry> entries;
+        entries.reserve(figures.size());
+        for (size_t i = 0; i < figures.size(); ++i) {
+            entries.push_back(Entry{figures[i]->bounding_box(), i});
+        }
+        build(entries);
+    }
+    
+    explicit UniformGrid(const FigureStore<T>& store) : cells_(1) {
+        std::vector<Entry> entries;
+        entries.reserve(store.size());
+        for (size_t i = 0; i < store.size(); ++i) {
+            entries.push_back(Entry{store.bounding_box(i), i});
+        }
+        build(entries);
+    }
+    
+    UniformGrid(const UniformGrid& other) = default;
+    
+    UniformGrid(UniformGrid&& other) noexcept = default;
+    
+    UniformGrid& operator=(const UniformGrid& other) = default;
+    
+    UniformGrid& operator=(UniformGrid&& other) noexcept = default;
+    
+    void insert(size_t id, const BoundingBox<T>& box) {
+        size_t column_end = column_of(box.max_x());
+        size_t row_end = row_of(box.max_y());
+        for (size_t row = row_of(box.min_y()); row <= row_end; ++row) {
+            for (size_t column = column_of(box.min_x()); column <= column_end; ++column) {
+                cells_[row * columns_ + column].push_back(Entry{box, id});
+            }
+        }
+        ++size_;
+    }
+    
+    bool remove(size_t id, const BoundingBox<T>& box) {
+        bool found = false;
+        size_t column_end = column_of(box.max_x());
+        size_t row_end = row_of(box.max_y());
+        for (size_t row = row_of(box.min_y()); row <= row_end; ++row) {
+            for (size_t column = column_of(box.min_x()); column <= column_end; ++column) {
+                std::vector<Entry>& cell = cells_[row * columns_ + column];
+                for (size_t i = 0; i < cell.size(); ++i) {
+                    if (cell[i].value == id && cell[i].box == box) {
+                        cell[i] = cell.back();
+                        cell.pop_back();
+                        found = true;
+                        break;
+                    }
+                }
+            }
+        }
+        
+        if (found) {
+            --size_;
+        }
+        return found;
+    }
+    
+    void query(const BoundingBox<T>& window, std::vector<size_t>& out) const {
+        size_t column_begin = column_of(window.min_x());
+        size_t column_end = column_of(window.max_x());
+        size_t row_begin = row_of(window.min_y());
+        size_t row_end = row_of(window.max_y());
+        
+        for (size_t row = row_begin; row <= row_end; ++row) {
+            for (size_t column = column_begin; column <= column_end; ++column) {
+                for (const Entry& entry : cells_[row * columns_ + column]) {
+                    if (!entry.box.intersects(window)) {
+                        continue;
+                    }
+                    size_t owner_column = std::max(column_begin, column_of(entry.box.min_x()));
+                    size_t owner_row = std::max(row_begin, row_of(entry.box.min_y()));
+                    if (owner_column == column && owner_row == row) {
+                        out.push_back(entry.value);
+                    }
+                }
+            }
+        }
+    }
+    
+    std::vector<size_t> query(const BoundingBox<T>& window) const {
+        std::vector<size_t> result;
+        query(window, result);
+        return result;
+    }
+    
+    void stab(const Point<T>& point, std::vector<size_t>& out) const {
+        query(BoundingBox<T>(point), out);
+    }
+    
+    std::vector<size_t> stab(const Point<T>& point) const {
+        return query(BoundingBox<T>(point));
+    }
+    
+    size_t size() const {
+        return size_;
+    }
+    
+    bool empty() const {
+        return size_ == 0;
+    }
+    
+    size_t columns() const {
+        return columns_;
+    }
+    
+    size_t rows() const {
+        return rows_;
+    }
+    
+    const BoundingBox<T>& bounds() const {
+        return bounds_;
+    }
+    
+    void clear() {
+        for (std::vector<Entry>& cell : cells_) {
+            cell.clear();
+        }
+        size_ = 0;
+    }
+};
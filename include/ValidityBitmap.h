@@ -0,0 +1,103 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+class ValidityBitmap {
+public:
+    static constexpr size_t bits_per_word = 64;
+
+private:
+    std::vector<std::uint64_t> words_;
+    size_t size_ = 0;
+    
+    static size_t word_count(size_t bits) {
+        return (bits + bits_per_word - 1) / bits_per_word;
+    }
+
+public:
+    ValidityBitmap() = default;
+    
+    explicit ValidityBitmap(size_t size) : words_(word_count(size), 0), size_(size) {}
+    
+    ValidityBitmap(const ValidityBitmap& other) = default;
+    
+    ValidityBitmap(ValidityBitmap&& other) noexcept = default;
+    
+    ValidityBitmap& operator=(const ValidityBitmap& other) = default;
+    
+    ValidityBitmap& operator=(ValidityBitmap&& other) noexcept = default;
+    
+    size_t size() const {
+        return size_;
+    }
+    
+    bool empty() const {
+        return size_ == 0;
+    }
+    
+    void resize(size_t size) {
+        words_.resize(word_count(size), 0);
+        if (size % bits_per_word != 0) {
+            words_.back() &= (std::uint64_t(1) << (size % bits_per_word)) - 1;
+        }
+        size_ = size;
+    }
+    
+    bool test(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return (words_[index / bits_per_word] >> (index % bits_per_word)) & 1;
+    }
+    
+    bool operator[](size_t index) const {
+        return (words_[index / bits_per_word] >> (index % bits_per_word)) & 1;
+    }
+    
+    void set(size_t index, bool value = true) {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        std::uint64_t mask = std::uint64_t(1) << (index % bits_per_word);
+        if (value) {
+            words_[index / bits_per_word] |= mask;
+        } else {
+            words_[index / bits_per_word] &= ~mask;
+        }
+    }
+    
+    std::uint64_t word(size_t index) const {
+        return words_[index];
+    }
+    
+    void set_word(size_t index, std::uint64_t bits) {
+        words_[index] = bits;
+    }
+    
+    size_t words() const {
+        return words_.size();
+    }
+    
+    size_t count() const {
+        size_t total = 0;
+        for (std::uint64_t word : words_) {
+            total += static_cast<size_t>(std::popcount(word));
+        }
+        return total;
+    }
+    
+    bool all() const {
+        return count() == size_;
+    }
+    
+    template<class Visitor>
+    void for_each_set(Visitor&& visitor) const {
+        for (size_t w = 0; w < words_.size(); ++w) {
+            for (std::uint64_t bits = words_[w]; bits != 0; bits &= bits - 1) {
+                visitor(w * bits_per_word + static_cast<size_t>(std::countr_zero(bits)));
+            }
+        }
+    }
+};
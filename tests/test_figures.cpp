@@ -5,7 +5,56 @@
 #include "Trapezoid.h"
 #include "Rhombus.h"
 #include "Array.h"
+#include "FigureStore.h"
+#include "CowArray.h"
+#include "SmallArray.h"
+#include "FigureVariant.h"
+#include "SimdKernels.h"
+#include "ThreadPool.h"
+#include "FigureStats.h"
+#include "BoundingBox.h"
+#include "RTree.h"
+#include "UniformGrid.h"
+#include "FigureFile.h"
+#include "MappedFigureFile.h"
+#include "FigureParser.h"
+#include "FigureFormatter.h"
+#include "FigureWriter.h"
+#include "FigureCacheStats.h"
+#include "FigureArena.h"
+#include "RectangleValue.h"
+#include "TrapezoidValue.h"
+#include "RhombusValue.h"
+#include "ConcurrentArray.h"
+#include "ValidityBitmap.h"
+#include "FigureBatch.h"
+#include "ExactGeometry.h"
+#include "Polygon.h"
+#include "AffineTransform.h"
+#include "FigureTransform.h"
+#include "SweepAndPrune.h"
+#include "FigureCollision.h"
+#include "FigureRanking.h"
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <limits>
 #include <memory>
+#include <sstream>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <memory_resource>
+#include <random>
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
 
 class PointTest : public ::testing::Test {
 protected:
@@ -247,6 +296,2396 @@ TEST(TemplateTest, DifferentTypes) {
     EXPECT_NEAR(double_rect.area(), 12.0, 1e-9);
 }
 
+class FigureStoreTest : public ::testing::Test {
+protected:
+    Array<std::shared_ptr<Figure<double>>> figures;
+    
+    void SetUp() override {
+        figures.push_back(std::make_shared<Rectangle<double>>(Point<double>(0, 0), 4, 3));
+        figures.push_back(std::make_shared<Trapezoid<double>>(Point<double>(1, 2), 6, 4, 3));
+        figures.push_back(std::make_shared<Rhombus<double>>(Point<double>(-1, 5), 6, 4));
+    }
+};
+
+TEST_F(FigureStoreTest, MatchesFigures) {
+    FigureStore<double> store(figures);
+    EXPECT_EQ(store.size(), 3);
+    EXPECT_EQ(store.kind(0), FigureKind::Rectangle);
+    EXPECT_EQ(store.kind(1), FigureKind::Trapezoid);
+    EXPECT_EQ(store.kind(2), FigureKind::Rhombus);
+    
+    for (size_t i = 0; i < figures.size(); ++i) {
+        EXPECT_EQ(store.area(i), figures[i]->area());
+        EXPECT_EQ(store.center(i), figures[i]->center());
+        for (size_t k = 0; k < 4; ++k) {
+            EXPECT_EQ(store.get_vertex(i, k), figures[i]->get_vertex(k));
+        }
+    }
+    EXPECT_NEAR(store.total_area(), 39.0, 1e-9);
+}
+
+TEST_F(FigureStoreTest, BulkAndIteration) {
+    FigureStore<double> store(figures);
+    std::vector<double> areas = store.areas();
+    std::vector<Point<double>> centers = store.centers();
+    ASSERT_EQ(areas.size(), 3);
+    
+    size_t i = 0;
+    for (auto figure : store) {
+        EXPECT_EQ(figure.area(), areas[i]);
+        EXPECT_EQ(figure.center(), centers[i]);
+        
+        std::ostringstream expected, actual;
+        expected << *figures[i];
+        actual << figure;
+        EXPECT_EQ(actual.str(), expected.str());
+        ++i;
+    }
+    EXPECT_EQ(i, 3);
+    EXPECT_THROW(store.area(3), std::out_of_range);
+}
+
+TEST_F(FigureStoreTest, RoundTrip) {
+    FigureStore<double> store(figures);
+    Array<std::shared_ptr<Figure<double>>> restored = store.to_array();
+    ASSERT_EQ(restored.size(), figures.size());
+    
+    EXPECT_NE(std::dynamic_pointer_cast<Rectangle<double>>(restored[0]), nullptr);
+    EXPECT_NE(std::dynamic_pointer_cast<Trapezoid<double>>(restored[1]), nullptr);
+    EXPECT_NE(std::dynamic_pointer_cast<Rhombus<double>>(restored[2]), nullptr);
+    for (size_t i = 0; i < figures.size(); ++i) {
+        EXPECT_TRUE(*restored[i] == *figures[i]);
+    }
+}
+
+TEST(FigureStoreIntTest, MatchesFigures) {
+    FigureStore<int> store;
+    Rectangle<int> rect(Point<int>(0, 0), 4, 3);
+    Rhombus<int> rhomb(Point<int>(1, 1), 6, 4);
+    store.push_back(rect);
+    store.push_back(rhomb);
+    
+    EXPECT_EQ(store.area(0), rect.area());
+    EXPECT_EQ(store.area(1), rhomb.area());
+    EXPECT_EQ(store.center(1), rhomb.center());
+}
+
+TEST(FigureStoreFloatTest, RoundTripSkipsRevalidation) {
+    FigureStore<float> store;
+    Rhombus<float> rhomb(Point<float>(0.1f, 0.3f), 0.7f, 0.9f);
+    Rectangle<float> rect(Point<float>(0.1f, 0.3f), 0.7f, 0.9f);
+    store.push_back(rhomb);
+    store.push_back(rect);
+    
+    Array<std::shared_ptr<Figure<float>>> restored = store.to_array();
+    ASSERT_EQ(restored.size(), 2);
+    EXPECT_NE(std::dynamic_pointer_cast<Rhombus<float>>(restored[0]), nullptr);
+    EXPECT_NE(std::dynamic_pointer_cast<Rectangle<float>>(restored[1]), nullptr);
+    EXPECT_TRUE(*restored[0] == rhomb);
+    EXPECT_TRUE(*restored[1] == rect);
+}
+
+TEST(FixedFigureTest, InlineVertices) {
+    Rectangle<double> rect(Point<double>(0, 0), 4, 3);
+    std::span<const Point<double>> vertices = rect.vertices();
+    ASSERT_EQ(vertices.size(), 4);
+    EXPECT_EQ(&vertices[0], &rect.get_vertex(0));
+    EXPECT_GE(reinterpret_cast<const char*>(vertices.data()), reinterpret_cast<const char*>(&rect));
+    EXPECT_LT(reinterpret_cast<const char*>(vertices.data()), reinterpret_cast<const char*>(&rect) + sizeof(rect));
+    EXPECT_THROW(rect.get_vertex(4), std::out_of_range);
+    
+    Rectangle<double> empty;
+    EXPECT_EQ(empty.vertex_count(), 0);
+    EXPECT_EQ(empty.area(), 0.0);
+    EXPECT_FALSE(empty == rect);
+    
+    empty = rect;
+    EXPECT_TRUE(empty == rect);
+}
+
+struct LifetimeCounter {
+    static inline int constructions = 0;
+    static inline int copies = 0;
+    static inline int destructions = 0;
+    
+    int value;
+    
+    explicit LifetimeCounter(int v) : value(v) { ++constructions; }
+    LifetimeCounter(const LifetimeCounter& other) : value(other.value) { ++constructions; ++copies; }
+    LifetimeCounter(LifetimeCounter&& other) noexcept : value(other.value) { ++constructions; }
+    LifetimeCounter& operator=(const LifetimeCounter& other) = default;
+    LifetimeCounter& operator=(LifetimeCounter&& other) noexcept = default;
+    ~LifetimeCounter() { ++destructions; }
+    
+    static void reset() {
+        constructions = 0;
+        copies = 0;
+        destructions = 0;
+    }
+};
+
+struct ThrowingMove {
+    static inline int copies = 0;
+    
+    int value;
+    
+    explicit ThrowingMove(int v) : value(v) {}
+    ThrowingMove(const ThrowingMove& other) : value(other.value) { ++copies; }
+    ThrowingMove(ThrowingMove&& other) : value(other.value) {}
+};
+
+TEST(ArrayStorageTest, NoPhantomElements) {
+    LifetimeCounter::reset();
+    {
+        Array<LifetimeCounter> arr(100);
+        EXPECT_EQ(LifetimeCounter::constructions, 0);
+        
+        arr.emplace_back(1);
+        arr.emplace_back(2);
+        EXPECT_EQ(LifetimeCounter::constructions, 2);
+        EXPECT_EQ(arr.capacity(), 100);
+    }
+    EXPECT_EQ(LifetimeCounter::destructions, 2);
+}
+
+TEST(ArrayStorageTest, ReserveEmplacePop) {
+    Array<Rectangle<double>> rects;
+    rects.reserve(8);
+    EXPECT_EQ(rects.capacity(), 8);
+    EXPECT_EQ(rects.size(), 0);
+    
+    Rectangle<double>& first = rects.emplace_back(Point<double>(0, 0), 4, 3);
+    EXPECT_NEAR(first.area(), 12.0, 1e-9);
+    rects.emplace_back(Point<double>(1, 1), 2, 2);
+    
+    rects.shrink_to_fit();
+    EXPECT_EQ(rects.capacity(), 2);
+    EXPECT_NEAR(rects[1].area(), 4.0, 1e-9);
+    
+    rects.pop_back();
+    EXPECT_EQ(rects.size(), 1);
+    rects.pop_back();
+    EXPECT_TRUE(rects.empty());
+    EXPECT_THROW(rects.pop_back(), std::out_of_range);
+}
+
+TEST(ArrayStorageTest, GrowthMovesWithoutCopies) {
+    LifetimeCounter::reset();
+    Array<LifetimeCounter> arr;
+    for (int i = 0; i < 100; ++i) {
+        arr.emplace_back(i);
+    }
+    EXPECT_EQ(LifetimeCounter::copies, 0);
+    EXPECT_EQ(LifetimeCounter::constructions - LifetimeCounter::destructions, 100);
+    EXPECT_EQ(arr[99].value, 99);
+    
+    arr.push_back(arr[0]);
+    EXPECT_EQ(arr[100].value, 0);
+    
+    arr.remove(0);
+    arr.clear();
+    EXPECT_EQ(LifetimeCounter::constructions, LifetimeCounter::destructions);
+}
+
+TEST(ArrayStorageTest, ThrowingMoveIsCopiedOnGrowth) {
+    ThrowingMove::copies = 0;
+    Array<ThrowingMove> arr;
+    arr.emplace_back(1);
+    arr.emplace_back(2);
+    arr.emplace_back(3);
+    EXPECT_EQ(ThrowingMove::copies, 3);
+    EXPECT_EQ(arr[2].value, 3);
+}
+
+TEST(CowArrayTest, SharesUntilMutation) {
+    CowArray<int> original;
+    original.push_back(1);
+    original.push_back(2);
+    
+    CowArray<int> copy = original;
+    EXPECT_TRUE(original.is_shared());
+    EXPECT_EQ(&copy.array(), &original.array());
+    
+    const CowArray<int>& const_copy = copy;
+    EXPECT_EQ(const_copy[1], 2);
+    EXPECT_TRUE(copy.is_shared());
+    
+    copy[0] = 10;
+    EXPECT_FALSE(copy.is_shared());
+    EXPECT_FALSE(original.is_shared());
+    EXPECT_EQ(original[0], 1);
+    EXPECT_EQ(copy[0], 10);
+    
+    CowArray<int> second = original;
+    second.remove(0);
+    EXPECT_EQ(original.size(), 2);
+    EXPECT_EQ(second.size(), 1);
+    EXPECT_EQ(second[0], 2);
+}
+
+TEST(CowArrayTest, MoveAndOutput) {
+    CowArray<int> arr;
+    arr.push_back(3);
+    arr.push_back(4);
+    
+    CowArray<int> moved = std::move(arr);
+    EXPECT_EQ(moved.size(), 2);
+    EXPECT_EQ(arr.size(), 0);
+    arr.push_back(5);
+    EXPECT_EQ(arr.size(), 1);
+    
+    std::ostringstream os;
+    os << moved;
+    EXPECT_EQ(os.str(), "[3, 4]");
+    EXPECT_THROW(moved[2], std::out_of_range);
+}
+
+TEST(CowArrayTest, ConstIterationDoesNotDetach) {
+    CowArray<int> original;
+    for (int i = 1; i <= 3; ++i) {
+        original.push_back(i);
+    }
+    
+    CowArray<int> copy = original;
+    const CowArray<int>& view = copy;
+    int sum = 0;
+    for (int value : view) {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 6);
+    EXPECT_EQ(std::distance(view.cbegin(), view.cend()), 3);
+    EXPECT_TRUE(copy.is_shared());
+    EXPECT_EQ(&copy.array(), &original.array());
+    
+    copy = CowArray<int>();
+    EXPECT_FALSE(original.is_shared());
+    EXPECT_EQ(original.size(), 3);
+}
+
+TEST(CowArrayTest, ConcurrentReadersWithWriter) {
+    CowArray<std::shared_ptr<Figure<double>>> figures;
+    for (int i = 0; i < 100; ++i) {
+        figures.push_back(std::make_shared<Rectangle<double>>(Point<double>(i, i), 2, 3));
+    }
+    
+    std::vector<std::thread> readers;
+    std::atomic<int> mismatches{0};
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([snapshot = figures, &mismatches]() {
+            double total = 0.0;
+            for (size_t i = 0; i < snapshot.size(); ++i) {
+                total += snapshot[i]->area();
+            }
+            if (std::abs(total - 600.0) > 1e-9) {
+                ++mismatches;
+            }
+        });
+    }
+    
+    for (int i = 0; i < 50; ++i) {
+        figures.remove(0);
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_EQ(figures.size(), 50);
+}
+
+template<class T>
+struct CountingAllocator {
+    using value_type = T;
+    
+    std::shared_ptr<int> allocations = std::make_shared<int>(0);
+    
+    CountingAllocator() = default;
+    
+    template<class U>
+    CountingAllocator(const CountingAllocator<U>& other) : allocations(other.allocations) {}
+    
+    T* allocate(size_t count) {
+        ++*allocations;
+        return std::allocator<T>().allocate(count);
+    }
+    
+    void deallocate(T* ptr, size_t count) {
+        std::allocator<T>().deallocate(ptr, count);
+    }
+    
+    template<class U>
+    bool operator==(const CountingAllocator<U>& other) const {
+        return allocations == other.allocations;
+    }
+};
+
+TEST(ArrayPolicyTest, DefaultPoliciesMatchPreviousBehavior) {
+    Array<int> arr;
+    std::vector<size_t> capacities;
+    for (int i = 0; i < 5; ++i) {
+        arr.push_back(i);
+        capacities.push_back(arr.capacity());
+    }
+    EXPECT_EQ(capacities, (std::vector<size_t>{1, 2, 4, 4, 8}));
+    EXPECT_THROW(arr[5], std::out_of_range);
+}
+
+TEST(ArrayPolicyTest, GrowthPolicies) {
+    Array<int, CheckedBounds, ChunkGrowth<16>> chunked;
+    for (int i = 0; i < 17; ++i) {
+        chunked.push_back(i);
+    }
+    EXPECT_EQ(chunked.capacity(), 32);
+    
+    Array<int, CheckedBounds, GeometricGrowth<3, 2, 4>> geometric;
+    std::vector<size_t> capacities;
+    for (int i = 0; i < 10; ++i) {
+        geometric.push_back(i);
+        if (capacities.empty() || capacities.back() != geometric.capacity()) {
+            capacities.push_back(geometric.capacity());
+        }
+    }
+    EXPECT_EQ(capacities, (std::vector<size_t>{4, 6, 9, 13}));
+}
+
+TEST(ArrayPolicyTest, UncheckedAccess) {
+    Array<int, UncheckedBounds> unchecked;
+    Array<int, AssertBounds> asserted;
+    for (int i = 0; i < 4; ++i) {
+        unchecked.push_back(i);
+        asserted.push_back(i);
+    }
+    EXPECT_EQ(unchecked[3], 3);
+    EXPECT_EQ(asserted[3], 3);
+    EXPECT_THROW(unchecked.at(4), std::out_of_range);
+    EXPECT_THROW(unchecked.remove(4), std::out_of_range);
+}
+
+TEST(ArrayPolicyTest, CustomAllocator) {
+    CountingAllocator<int> allocator;
+    Array<int, CheckedBounds, GeometricGrowth<>, CountingAllocator<int>> arr(allocator);
+    for (int i = 0; i < 8; ++i) {
+        arr.push_back(i);
+    }
+    EXPECT_EQ(*allocator.allocations, 4);
+    
+    auto copy = arr;
+    EXPECT_EQ(*allocator.allocations, 5);
+    EXPECT_EQ(copy[7], 7);
+}
+
+TEST(ArrayPolicyTest, PolymorphicAllocator) {
+    std::pmr::monotonic_buffer_resource arena;
+    PmrArray<std::shared_ptr<Figure<double>>> figures(&arena);
+    figures.push_back(std::make_shared<Rectangle<double>>(Point<double>(0, 0), 4, 3));
+    figures.push_back(std::make_shared<Rhombus<double>>(Point<double>(0, 0), 6, 4));
+    EXPECT_EQ(figures.get_allocator().resource(), &arena);
+    EXPECT_NEAR(figures[0]->area() + figures[1]->area(), 24.0, 1e-9);
+    
+    PmrArray<std::shared_ptr<Figure<double>>> other(std::pmr::new_delete_resource());
+    other = figures;
+    EXPECT_EQ(other.get_allocator().resource(), std::pmr::new_delete_resource());
+    other = std::move(figures);
+    EXPECT_EQ(other.size(), 2);
+    EXPECT_EQ(figures.size(), 0);
+    EXPECT_EQ(other.get_allocator().resource(), std::pmr::new_delete_resource());
+}
+
+TEST(SmallArrayTest, StaysInlineUpToCapacity) {
+    SmallArray<int, 4> arr;
+    EXPECT_TRUE(arr.is_small());
+    EXPECT_EQ(arr.capacity(), 4);
+    
+    for (int i = 0; i < 4; ++i) {
+        arr.push_back(i);
+    }
+    EXPECT_TRUE(arr.is_small());
+    
+    arr.push_back(4);
+    EXPECT_FALSE(arr.is_small());
+    EXPECT_EQ(arr.capacity(), 8);
+    EXPECT_EQ(arr[4], 4);
+    
+    arr.remove(0);
+    arr.pop_back();
+    arr.shrink_to_fit();
+    EXPECT_TRUE(arr.is_small());
+    
+    std::ostringstream os;
+    os << arr;
+    EXPECT_EQ(os.str(), "[1, 2, 3]");
+    EXPECT_THROW(arr[3], std::out_of_range);
+}
+
+TEST(SmallArrayTest, ConstIteration) {
+    SmallArray<int, 2> arr;
+    for (int i = 1; i <= 3; ++i) {
+        arr.push_back(i);
+    }
+    
+    const SmallArray<int, 2>& view = arr;
+    int sum = 0;
+    for (int value : view) {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 6);
+    EXPECT_EQ(std::distance(view.cbegin(), view.cend()), 3);
+    EXPECT_EQ(*std::max_element(view.begin(), view.end()), 3);
+}
+
+TEST(SmallArrayTest, CopyAndMove) {
+    SmallArray<std::shared_ptr<Figure<double>>, 2> figures;
+    figures.push_back(std::make_shared<Rectangle<double>>(Point<double>(0, 0), 4, 3));
+    figures.push_back(std::make_shared<Rhombus<double>>(Point<double>(0, 0), 6, 4));
+    
+    auto copied = figures;
+    EXPECT_EQ(copied.size(), 2);
+    EXPECT_EQ(copied[0], figures[0]);
+    
+    auto moved = std::move(copied);
+    EXPECT_EQ(moved.size(), 2);
+    EXPECT_EQ(copied.size(), 0);
+    
+    figures.push_back(std::make_shared<Trapezoid<double>>(Point<double>(0, 0), 6, 4, 3));
+    moved = std::move(figures);
+    EXPECT_EQ(moved.size(), 3);
+    EXPECT_FALSE(moved.is_small());
+    
+    double total = 0.0;
+    for (auto it = moved.begin(); it != moved.end(); ++it) {
+        total += (*it)->area();
+    }
+    EXPECT_NEAR(total, 39.0, 1e-9);
+}
+
+TEST_F(ArrayTest, SwapRemove) {
+    arr.push_back(4);
+    arr.swap_remove(0);
+    EXPECT_EQ(arr.size(), 3);
+    EXPECT_EQ(arr[0], 4);
+    EXPECT_EQ(arr[1], 2);
+    EXPECT_EQ(arr[2], 3);
+    
+    arr.swap_remove(2);
+    EXPECT_EQ(arr.size(), 2);
+    EXPECT_THROW(arr.swap_remove(2), std::out_of_range);
+}
+
+TEST_F(ArrayTest, RemoveIndices) {
+    arr.push_back(4);
+    arr.push_back(5);
+    std::vector<size_t> indices{0, 2, 4};
+    arr.remove_indices(indices);
+    EXPECT_EQ(arr.size(), 2);
+    EXPECT_EQ(arr[0], 2);
+    EXPECT_EQ(arr[1], 4);
+    
+    std::vector<size_t> unsorted{1, 0};
+    EXPECT_THROW(arr.remove_indices(unsorted), std::invalid_argument);
+    std::vector<size_t> out_of_range{5};
+    EXPECT_THROW(arr.remove_indices(out_of_range), std::out_of_range);
+    EXPECT_EQ(arr.size(), 2);
+}
+
+TEST_F(FigureArrayTest, EraseIf) {
+    figures.push_back(std::make_shared<Rectangle<double>>(Point<double>(5, 5), 1, 1));
+    figures.push_back(std::make_shared<Rhombus<double>>(Point<double>(5, 5), 2, 1));
+    
+    size_t removed = figures.erase_if([](const std::shared_ptr<Figure<double>>& figure) {
+        return figure->area() < 2.0;
+    });
+    EXPECT_EQ(removed, 2);
+    EXPECT_EQ(figures.size(), 3);
+    EXPECT_NEAR(figures[0]->area(), 12.0, 1e-9);
+    EXPECT_NEAR(figures[1]->area(), 15.0, 1e-9);
+    EXPECT_NEAR(figures[2]->area(), 12.0, 1e-9);
+    
+    CowArray<std::shared_ptr<Figure<double>>> shared(figures);
+    CowArray<std::shared_ptr<Figure<double>>> copy = shared;
+    copy.erase_if([](const auto& figure) { return figure->area() > 13.0; });
+    EXPECT_EQ(copy.size(), 2);
+    EXPECT_EQ(shared.size(), 3);
+}
+
+TEST_F(FigureArrayTest, VariantMatchesVirtual) {
+    Array<FigureVariant<double>> variants = to_variant_array(figures);
+    ASSERT_EQ(variants.size(), figures.size());
+    EXPECT_TRUE(variants[0].holds<Rectangle<double>>());
+    EXPECT_TRUE(variants[1].holds<Trapezoid<double>>());
+    EXPECT_TRUE(variants[2].holds<Rhombus<double>>());
+    
+    for (size_t i = 0; i < figures.size(); ++i) {
+        EXPECT_EQ(variants[i].area(), figures[i]->area());
+        EXPECT_EQ(variants[i].center(), figures[i]->center());
+        EXPECT_EQ(variants[i].vertex_count(), figures[i]->vertex_count());
+        
+        std::ostringstream expected, actual;
+        expected << *figures[i];
+        actual << variants[i];
+        EXPECT_EQ(actual.str(), expected.str());
+    }
+    EXPECT_NEAR(total_area(variants), 39.0, 1e-9);
+}
+
+TEST_F(FigureArrayTest, VariantRoundTripAndEquality) {
+    Array<FigureVariant<double>> variants = to_variant_array(figures);
+    Array<std::shared_ptr<Figure<double>>> restored = to_figure_array(variants);
+    for (size_t i = 0; i < figures.size(); ++i) {
+        EXPECT_TRUE(*restored[i] == *figures[i]);
+    }
+    
+    FigureVariant<double> rect = Rectangle<double>(Point<double>(0, 0), 4, 3);
+    FigureVariant<double> same = Rectangle<double>(Point<double>(0, 0), 4, 3);
+    FigureVariant<double> other = Rectangle<double>(Point<double>(1, 0), 4, 3);
+    EXPECT_TRUE(rect == same);
+    EXPECT_TRUE(rect != other);
+    EXPECT_FALSE(rect == variants[1]);
+    EXPECT_NEAR(static_cast<double>(rect), 12.0, 1e-9);
+}
+
+template<Scalar T>
+class SimdKernelTest : public ::testing::Test {
+protected:
+    std::vector<std::shared_ptr<Figure<T>>> figures;
+    FigureStore<T> store;
+    
+    void SetUp() override {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> coordinate(-500, 500);
+        std::uniform_int_distribution<int> size(1, 40);
+        
+        for (int i = 0; i < 103; ++i) {
+            Point<T> center(static_cast<T>(coordinate(rng)), static_cast<T>(coordinate(rng)));
+            T a = static_cast<T>(size(rng) * 2);
+            T b = static_cast<T>(size(rng) * 2);
+            switch (i % 3) {
+                case 0:
+                    figures.push_back(std::make_shared<Rectangle<T>>(center, a, b));
+                    break;
+                case 1:
+                    figures.push_back(std::make_shared<Trapezoid<T>>(center, a, b, static_cast<T>(size(rng) * 2)));
+                    break;
+                default:
+                    figures.push_back(std::make_shared<Rhombus<T>>(center, a, b));
+                    break;
+            }
+            store.push_back(*figures.back());
+        }
+    }
+};
+
+using SimdScalarTypes = ::testing::Types<double, float, int>;
+TYPED_TEST_SUITE(SimdKernelTest, SimdScalarTypes);
+
+TYPED_TEST(SimdKernelTest, AreasMatchFigures) {
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2}) {
+        std::vector<double> areas(this->figures.size());
+        batch_areas(this->store.columns(), areas.data(), level);
+        
+        double expected_total = 0.0;
+        for (size_t i = 0; i < this->figures.size(); ++i) {
+            double expected = this->figures[i]->area();
+            EXPECT_NEAR(areas[i], expected, 1e-6 * std::max(1.0, expected));
+            expected_total += expected;
+        }
+        EXPECT_NEAR(batch_total_area(this->store.columns(), level), expected_total, 1e-6 * expected_total);
+    }
+}
+
+TYPED_TEST(SimdKernelTest, CentersMatchFigures) {
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2}) {
+        std::vector<TypeParam> center_x(this->figures.size());
+        std::vector<TypeParam> center_y(this->figures.size());
+        batch_centers(this->store.columns(), center_x.data(), center_y.data(), level);
+        
+        for (size_t i = 0; i < this->figures.size(); ++i) {
+            Point<TypeParam> expected = this->figures[i]->center();
+            EXPECT_NEAR(center_x[i], expected.x(), 1e-4);
+            EXPECT_NEAR(center_y[i], expected.y(), 1e-4);
+        }
+    }
+}
+
+TEST(SimdKernelIntTest, NegativeCentersTruncateLikeFigures) {
+    FigureStore<int> store;
+    std::vector<Rectangle<int>> rects;
+    for (int i = 0; i < 9; ++i) {
+        rects.emplace_back(-3, -3, -3 + i + 1, -3, -3 + i + 1, 0, -3, 0);
+        store.push_back(rects.back());
+    }
+    
+    std::vector<int> center_x(rects.size());
+    std::vector<int> center_y(rects.size());
+    batch_centers(store.columns(), center_x.data(), center_y.data());
+    for (size_t i = 0; i < rects.size(); ++i) {
+        EXPECT_EQ(center_x[i], rects[i].center().x());
+        EXPECT_EQ(center_y[i], rects[i].center().y());
+    }
+}
+
+TEST(ThreadPoolTest, RunsEveryIndexOnce) {
+    ThreadPool pool(3);
+    EXPECT_EQ(pool.thread_count(), 3);
+    
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallel_for(hits.size(), [&](size_t i) {
+        hits[i].fetch_add(1);
+    });
+    for (const auto& hit : hits) {
+        EXPECT_EQ(hit.load(), 1);
+    }
+    
+    EXPECT_THROW(pool.parallel_for(10, [](size_t i) {
+        if (i == 7) {
+            throw std::runtime_error("failed");
+        }
+    }), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, NestedParallelFor) {
+    ThreadPool pool(2);
+    std::atomic<int> total{0};
+    pool.parallel_for(4, [&](size_t) {
+        pool.parallel_for(4, [&](size_t) {
+            total.fetch_add(1);
+        });
+    });
+    EXPECT_EQ(total.load(), 16);
+}
+
+class FigureStatsTest : public ::testing::Test {
+protected:
+    Array<std::shared_ptr<Figure<double>>> figures;
+    
+    void SetUp() override {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+        std::uniform_real_distribution<double> size(0.1, 50.0);
+        for (int i = 0; i < 10000; ++i) {
+            Point<double> center(coordinate(rng), coordinate(rng));
+            switch (i % 3) {
+                case 0:
+                    figures.push_back(std::make_shared<Rectangle<double>>(center, size(rng), size(rng)));
+                    break;
+                case 1:
+                    figures.push_back(std::make_shared<Trapezoid<double>>(center, size(rng), size(rng), size(rng)));
+                    break;
+                default:
+                    figures.push_back(std::make_shared<Rhombus<double>>(center, size(rng), size(rng)));
+                    break;
+            }
+        }
+    }
+};
+
+TEST_F(FigureStatsTest, MatchesSerialComputation) {
+    double total = 0.0;
+    double min_area = figures[0]->area();
+    double max_area = min_area;
+    double moment_x = 0.0;
+    double moment_y = 0.0;
+    for (size_t i = 0; i < figures.size(); ++i) {
+        double area = figures[i]->area();
+        total += area;
+        min_area = std::min(min_area, area);
+        max_area = std::max(max_area, area);
+        moment_x += area * figures[i]->center().x();
+        moment_y += area * figures[i]->center().y();
+    }
+    
+    ThreadPool pool(4);
+    FigureStats stats = figure_stats(figures, pool, 256);
+    EXPECT_EQ(stats.count, figures.size());
+    EXPECT_NEAR(stats.total_area, total, 1e-9 * total);
+    EXPECT_EQ(stats.min_area, min_area);
+    EXPECT_EQ(stats.max_area, max_area);
+    EXPECT_NEAR(stats.mean_area, total / figures.size(), 1e-9);
+    EXPECT_NEAR(stats.centroid.x(), moment_x / total, 1e-6);
+    EXPECT_NEAR(stats.centroid.y(), moment_y / total, 1e-6);
+}
+
+TEST_F(FigureStatsTest, DeterministicAcrossThreadCounts) {
+    FigureStore<double> store(figures);
+    
+    ThreadPool single(1);
+    FigureStats reference = figure_stats(figures, single, 512);
+    FigureStats store_reference = figure_stats(store, single, 512);
+    EXPECT_EQ(store_reference.total_area, reference.total_area);
+    EXPECT_EQ(store_reference.centroid, reference.centroid);
+    
+    for (size_t threads : {2, 3, 5}) {
+        ThreadPool pool(threads);
+        FigureStats stats = figure_stats(figures, pool, 512);
+        EXPECT_EQ(stats.total_area, reference.total_area);
+        EXPECT_EQ(stats.centroid.x(), reference.centroid.x());
+        EXPECT_EQ(stats.centroid.y(), reference.centroid.y());
+        
+        FigureStats store_stats = figure_stats(store, pool, 512);
+        EXPECT_EQ(store_stats.total_area, store_reference.total_area);
+        EXPECT_EQ(store_stats.min_area, store_reference.min_area);
+        EXPECT_EQ(store_stats.max_area, store_reference.max_area);
+    }
+}
+
+TEST(FigureStatsEmptyTest, EmptyCollection) {
+    ThreadPool pool(2);
+    Array<std::shared_ptr<Figure<int>>> figures;
+    FigureStats stats = figure_stats(figures, pool);
+    EXPECT_EQ(stats.count, 0);
+    EXPECT_EQ(stats.total_area, 0.0);
+}
+
+TEST(BoundingBoxTest, FigureBoundingBox) {
+    Rhombus<double> rhombus(Point<double>(1.0, 2.0), 6.0, 4.0);
+    BoundingBox<double> box = rhombus.bounding_box();
+    EXPECT_EQ(box, BoundingBox<double>(-2.0, 0.0, 4.0, 4.0));
+    EXPECT_DOUBLE_EQ(box.area(), 24.0);
+    EXPECT_TRUE(box.contains(Point<double>(1.0, 2.0)));
+    EXPECT_FALSE(box.contains(Point<double>(5.0, 2.0)));
+    EXPECT_TRUE(box.intersects(BoundingBox<double>(4.0, 4.0, 5.0, 5.0)));
+    EXPECT_FALSE(box.intersects(BoundingBox<double>(4.5, 0.0, 5.0, 5.0)));
+    EXPECT_THROW(BoundingBox<double>(1.0, 0.0, 0.0, 1.0), std::invalid_argument);
+    
+    FigureStore<double> store;
+    store.push_back(rhombus);
+    EXPECT_EQ(store.bounding_box(0), box);
+    EXPECT_EQ(store[0].bounding_box(), box);
+    EXPECT_THROW(store.bounding_box(1), std::out_of_range);
+}
+
+class SpatialIndexTest : public ::testing::Test {
+protected:
+    Array<std::shared_ptr<Figure<double>>> figures;
+    std::mt19937 rng{11};
+    
+    void SetUp() override {
+        std::uniform_real_distribution<double> coordinate(-500.0, 500.0);
+        std::uniform_real_distribution<double> size(0.5, 20.0);
+        for (int i = 0; i < 5000; ++i) {
+            Point<double> center(coordinate(rng), coordinate(rng));
+            switch (i % 3) {
+                case 0:
+                    figures.push_back(std::make_shared<Rectangle<double>>(center, size(rng), size(rng)));
+                    break;
+                case 1:
+                    figures.push_back(std::make_shared<Trapezoid<double>>(center, size(rng), size(rng), size(rng)));
+                    break;
+                default:
+                    figures.push_back(std::make_shared<Rhombus<double>>(center, size(rng), size(rng)));
+                    break;
+            }
+        }
+    }
+    
+    std::vector<size_t> brute_force(const BoundingBox<double>& window) const {
+        std::vector<size_t> result;
+        for (size_t i = 0; i < figures.size(); ++i) {
+            if (figures[i]->bounding_box().intersects(window)) {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+    
+    BoundingBox<double> random_window() {
+        std::uniform_real_distribution<double> coordinate(-600.0, 600.0);
+        std::uniform_real_distribution<double> size(0.0, 150.0);
+        double x = coordinate(rng);
+        double y = coordinate(rng);
+        return BoundingBox<double>(x, y, x + size(rng), y + size(rng));
+    }
+    
+    static std::vector<size_t> sorted(std::vector<size_t> ids) {
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+};
+
+TEST_F(SpatialIndexTest, WindowQueriesMatchBruteForce) {
+    RTree<double> tree(figures);
+    UniformGrid<double> grid(figures);
+    EXPECT_EQ(tree.size(), figures.size());
+    EXPECT_EQ(grid.size(), figures.size());
+    
+    for (int i = 0; i < 200; ++i) {
+        BoundingBox<double> window = random_window();
+        std::vector<size_t> expected = brute_force(window);
+        EXPECT_EQ(sorted(tree.query(window)), expected);
+        EXPECT_EQ(sorted(grid.query(window)), expected);
+    }
+}
+
+TEST_F(SpatialIndexTest, PointStabbing) {
+    RTree<double> tree(figures);
+    UniformGrid<double> grid(figures);
+    
+    for (size_t i = 0; i < figures.size(); i += 97) {
+        Point<double> center = figures[i]->center();
+        std::vector<size_t> expected = brute_force(BoundingBox<double>(center));
+        EXPECT_EQ(sorted(tree.stab(center)), expected);
+        EXPECT_EQ(sorted(grid.stab(center)), expected);
+        EXPECT_TRUE(std::binary_search(expected.begin(), expected.end(), i));
+    }
+}
+
+TEST_F(SpatialIndexTest, IncrementalInsertAndRemove) {
+    RTree<double, 4> tree;
+    UniformGrid<double> grid(BoundingBox<double>(-500.0, -500.0, 500.0, 500.0), 64, 64);
+    for (size_t i = 0; i < figures.size(); ++i) {
+        tree.insert(i, figures[i]->bounding_box());
+        grid.insert(i, figures[i]->bounding_box());
+    }
+    EXPECT_GT(tree.height(), 1);
+    
+    for (size_t i = 0; i < figures.size(); i += 2) {
+        EXPECT_TRUE(tree.remove(i, figures[i]->bounding_box()));
+        EXPECT_TRUE(grid.remove(i, figures[i]->bounding_box()));
+    }
+    EXPECT_FALSE(tree.remove(0, figures[0]->bounding_box()));
+    EXPECT_FALSE(grid.remove(0, figures[0]->bounding_box()));
+    EXPECT_EQ(tree.size(), figures.size() / 2);
+    EXPECT_EQ(grid.size(), figures.size() / 2);
+    
+    for (int i = 0; i < 100; ++i) {
+        BoundingBox<double> window = random_window();
+        std::vector<size_t> expected;
+        for (size_t id : brute_force(window)) {
+            if (id % 2 == 1) {
+                expected.push_back(id);
+            }
+        }
+        EXPECT_EQ(sorted(tree.query(window)), expected);
+        EXPECT_EQ(sorted(grid.query(window)), expected);
+    }
+    
+    for (size_t i = 1; i < figures.size(); i += 2) {
+        EXPECT_TRUE(tree.remove(i, figures[i]->bounding_box()));
+    }
+    EXPECT_TRUE(tree.empty());
+    EXPECT_TRUE(tree.query(random_window()).empty());
+}
+
+TEST(SpatialIndexStoreTest, BuildsFromFigureStore) {
+    FigureStore<int> store;
+    store.push_back(Rectangle<int>(Point<int>(0, 0), 4, 4));
+    store.push_back(Rectangle<int>(Point<int>(10, 10), 2, 2));
+    store.push_back(Rhombus<int>(Point<int>(-10, 5), 4, 2));
+    
+    RTree<int> tree(store);
+    UniformGrid<int> grid(store);
+    EXPECT_EQ(tree.stab(Point<int>(1, 1)), std::vector<size_t>{0});
+    EXPECT_EQ(grid.stab(Point<int>(1, 1)), std::vector<size_t>{0});
+    
+    std::vector<size_t> tree_hits = tree.query(BoundingBox<int>(-20, 0, 9, 9));
+    std::vector<size_t> grid_hits = grid.query(BoundingBox<int>(-20, 0, 9, 9));
+    std::sort(tree_hits.begin(), tree_hits.end());
+    std::sort(grid_hits.begin(), grid_hits.end());
+    EXPECT_EQ(tree_hits, (std::vector<size_t>{0, 1, 2}));
+    EXPECT_EQ(grid_hits, (std::vector<size_t>{0, 1, 2}));
+    EXPECT_TRUE(tree.query(BoundingBox<int>(3, -5, 8, -3)).empty());
+}
+
+class FigureFileTest : public ::testing::Test {
+protected:
+    std::string path;
+    
+    void SetUp() override {
+        path = (std::filesystem::temp_directory_path() / 
+                ("figures_" + std::to_string(::getpid()) + "_" + 
+                 ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin")).string();
+    }
+    
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+    
+    template<Scalar T>
+    static Array<std::shared_ptr<Figure<T>>> make_figures(size_t count) {
+        Array<std::shared_ptr<Figure<T>>> figures;
+        for (size_t i = 0; i < count; ++i) {
+            Point<T> center(static_cast<T>(i % 100), static_cast<T>(i % 37));
+            switch (i % 3) {
+                case 0:
+                    figures.push_back(std::make_shared<Rectangle<T>>(center, 4, 6));
+                    break;
+                case 1:
+                    figures.push_back(std::make_shared<Trapezoid<T>>(center, 6, 4, 2));
+                    break;
+                default:
+                    figures.push_back(std::make_shared<Rhombus<T>>(center, 6, 4));
+                    break;
+            }
+        }
+        return figures;
+    }
+    
+    template<Scalar T>
+    void expect_round_trip(size_t count) {
+        auto figures = make_figures<T>(count);
+        write_figure_file(path, figures);
+        
+        MappedFigureFile<T> file(path);
+        ASSERT_EQ(file.size(), figures.size());
+        double total = 0.0;
+        for (size_t i = 0; i < figures.size(); ++i) {
+            EXPECT_DOUBLE_EQ(file.area(i), figures[i]->area());
+            EXPECT_EQ(file.center(i), figures[i]->center());
+            EXPECT_EQ(file.bounding_box(i), figures[i]->bounding_box());
+            for (size_t k = 0; k < 4; ++k) {
+                EXPECT_EQ(file.get_vertex(i, k), figures[i]->get_vertex(k));
+            }
+            EXPECT_EQ(*file.make_figure(i), *figures[i]);
+            total += figures[i]->area();
+        }
+        EXPECT_NEAR(file.total_area(), total, 1e-9 * total);
+        EXPECT_THROW(file.area(figures.size()), std::out_of_range);
+    }
+    
+    void corrupt_kind(size_t index) {
+        MappedFigureFile<double> file(path, FigureFileValidation::None);
+        size_t offset = static_cast<size_t>(file.header().offsets[0]) + index;
+        std::fstream stream(path, std::ios::in | std::ios::out | std::ios::binary);
+        stream.seekp(static_cast<std::streamoff>(offset));
+        stream.put(static_cast<char>(42));
+    }
+};
+
+TEST_F(FigureFileTest, RoundTripDouble) {
+    expect_round_trip<double>(1000);
+}
+
+TEST_F(FigureFileTest, RoundTripFloat) {
+    expect_round_trip<float>(1000);
+}
+
+TEST_F(FigureFileTest, RoundTripInt) {
+    expect_round_trip<int>(1000);
+}
+
+TEST_F(FigureFileTest, EmptyFile) {
+    write_figure_file(path, Array<std::shared_ptr<Figure<double>>>());
+    MappedFigureFile<double> file(path, FigureFileValidation::Eager);
+    EXPECT_TRUE(file.empty());
+    EXPECT_EQ(file.total_area(), 0.0);
+}
+
+TEST_F(FigureFileTest, RejectsMismatchedScalarType) {
+    write_figure_file(path, make_figures<float>(10));
+    EXPECT_THROW(MappedFigureFile<double>{path}, std::runtime_error);
+    EXPECT_THROW(MappedFigureFile<int>{path}, std::runtime_error);
+    EXPECT_NO_THROW(MappedFigureFile<float>{path});
+}
+
+TEST_F(FigureFileTest, RejectsTruncatedAndForeignFiles) {
+    write_figure_file(path, make_figures<double>(100));
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+    EXPECT_THROW(MappedFigureFile<double>{path}, std::runtime_error);
+    
+    std::ofstream(path, std::ios::trunc) << "Center: (0, 0), Area: 0";
+    EXPECT_THROW(MappedFigureFile<double>{path}, std::runtime_error);
+    EXPECT_THROW(MappedFigureFile<double>{path + ".missing"}, std::runtime_error);
+}
+
+TEST_F(FigureFileTest, LazyValidationChecksTouchedBlocksOnly) {
+    size_t count = 3 * MappedFigureFile<double>::validation_block;
+    write_figure_file(path, make_figures<double>(count));
+    corrupt_kind(count - 1);
+    
+    EXPECT_THROW(MappedFigureFile<double>(path, FigureFileValidation::Eager), std::runtime_error);
+    
+    MappedFigureFile<double> lazy(path, FigureFileValidation::Lazy);
+    EXPECT_NO_THROW(lazy.area(0));
+    EXPECT_THROW(lazy.area(count - 2), std::runtime_error);
+    EXPECT_THROW(lazy.total_area(), std::runtime_error);
+    
+    MappedFigureFile<double> trusted(path, FigureFileValidation::None);
+    EXPECT_NO_THROW(trusted.area(0));
+    EXPECT_THROW(trusted.validate(), std::runtime_error);
+}
+
+TEST_F(FigureFileTest, MoveTransfersMapping) {
+    write_figure_file(path, make_figures<double>(10));
+    MappedFigureFile<double> file(path);
+    double area = file.area(3);
+    
+    MappedFigureFile<double> moved(std::move(file));
+    EXPECT_EQ(moved.area(3), area);
+    EXPECT_TRUE(file.empty());
+    
+    file = std::move(moved);
+    EXPECT_EQ(file.area(3), area);
+}
+
+TEST(FigureParserTest, ParsesVertexAndCenterForms) {
+    std::string text = 
+        "# kind and coordinates\n"
+        "rectangle 0 0 4 0 4 3 0 3\n"
+        "rectangle 1.5 2.5 4 6\n"
+        "\n"
+        "trapezoid 0, 0, 6, 4, 2\n"
+        "rhombus 1 2 6 4\r\n"
+        "rhombus 0 -2 3 0 0 2 -3 0";
+    
+    Array<std::shared_ptr<Figure<double>>> figures;
+    FigureParser<double> parser;
+    FigureParseResult result = parser.parse(text, figures);
+    
+    EXPECT_TRUE(result.ok());
+    EXPECT_EQ(result.lines, 7);
+    EXPECT_EQ(result.figures, 5);
+    ASSERT_EQ(figures.size(), 5);
+    EXPECT_DOUBLE_EQ(figures[0]->area(), 12.0);
+    EXPECT_EQ(*figures[1], Rectangle<double>(Point<double>(1.5, 2.5), 4.0, 6.0));
+    EXPECT_EQ(*figures[2], Trapezoid<double>(Point<double>(0.0, 0.0), 6.0, 4.0, 2.0));
+    EXPECT_EQ(*figures[3], Rhombus<double>(Point<double>(1.0, 2.0), 6.0, 4.0));
+    EXPECT_DOUBLE_EQ(figures[4]->area(), 12.0);
+    EXPECT_NE(dynamic_cast<Rhombus<double>*>(figures[4].get()), nullptr);
+}
+
+TEST(FigureParserTest, ReportsErrorsPerLine) {
+    std::string text = 
+        "rectangle 0 0 4 0 4 3 0 3\n"
+        "circle 0 0 1\n"
+        "rectangle 0 0 abc 1\n"
+        "rectangle 0 0 4 0 5 3 0 3\n"
+        "trapezoid 0 0 6 4\n"
+        "rhombus 1 2 3 4 5 6 7 8 9\n"
+        "rectangle 0 0 -1 2\n"
+        "rhombus 1 2 6 4\n";
+    
+    FigureStore<double> store;
+    FigureParser<double> parser;
+    FigureParseResult result = parser.parse(text, store);
+    
+    EXPECT_EQ(store.size(), 2);
+    EXPECT_EQ(store.kind(1), FigureKind::Rhombus);
+    EXPECT_EQ(result.figures, 2);
+    ASSERT_EQ(result.errors.size(), 6);
+    EXPECT_EQ(result.errors[0].line, 2);
+    EXPECT_EQ(result.errors[0].message, "Unknown figure kind 'circle'");
+    EXPECT_EQ(result.errors[1].line, 3);
+    EXPECT_EQ(result.errors[1].message, "Invalid number 'abc'");
+    EXPECT_EQ(result.errors[2].line, 4);
+    EXPECT_EQ(result.errors[2].message, "Points do not form a valid rectangle");
+    EXPECT_EQ(result.errors[3].line, 5);
+    EXPECT_EQ(result.errors[4].line, 6);
+    EXPECT_EQ(result.errors[4].message, "Too many values");
+    EXPECT_EQ(result.errors[5].line, 7);
+}
+
+TEST(FigureParserTest, ChunkBoundariesDoNotMatter) {
+    std::string text;
+    for (int i = 0; i < 200; ++i) {
+        text += "rectangle " + std::to_string(i) + " " + std::to_string(-i) + " 4 6\n";
+        text += "trapezoid " + std::to_string(i) + " 1 6 4 2\n";
+    }
+    
+    FigureStore<int> expected;
+    FigureParser<int> parser;
+    EXPECT_TRUE(parser.parse(text, expected).ok());
+    
+    for (size_t step : {1, 3, 17, 4096}) {
+        FigureStore<int> store;
+        for (size_t offset = 0; offset < text.size(); offset += step) {
+            parser.feed(std::string_view(text).substr(offset, step), store);
+        }
+        FigureParseResult result = parser.finish(store);
+        EXPECT_TRUE(result.ok());
+        EXPECT_EQ(result.figures, 400);
+        ASSERT_EQ(store.size(), expected.size());
+        for (size_t i = 0; i < store.size(); ++i) {
+            EXPECT_EQ(store.kind(i), expected.kind(i));
+            EXPECT_EQ(store.get_vertex(i, 2), expected.get_vertex(i, 2));
+        }
+    }
+}
+
+TEST(FigureParserTest, ParsesFileInSmallChunks) {
+    std::string path = (std::filesystem::temp_directory_path() / 
+                        ("figures_parser_" + std::to_string(::getpid()) + ".txt")).string();
+    {
+        std::ofstream out(path);
+        for (int i = 0; i < 1000; ++i) {
+            out << "rhombus " << i << " 0.5 6 4\n";
+        }
+        out << "rhombus 1 2";
+    }
+    
+    size_t count = 0;
+    double total = 0.0;
+    FigureParser<float> parser(64);
+    FigureParseResult result = parser.parse_file(path, [&](const Figure<float>& figure) {
+        ++count;
+        total += figure.area();
+    });
+    std::filesystem::remove(path);
+    
+    EXPECT_EQ(count, 1000);
+    EXPECT_NEAR(total, 12000.0, 1e-6);
+    EXPECT_EQ(result.lines, 1001);
+    ASSERT_EQ(result.errors.size(), 1);
+    EXPECT_EQ(result.errors[0].line, 1001);
+    EXPECT_THROW(parser.parse_file(path, [](const auto&) {}), std::runtime_error);
+}
+
+TEST(FigureFormatterTest, HumanLayoutMatchesStreamOperator) {
+    Array<std::shared_ptr<Figure<double>>> figures;
+    figures.push_back(std::make_shared<Rectangle<double>>(Point<double>(1.0 / 3.0, -2.5), 4.0, 6.125));
+    figures.push_back(std::make_shared<Trapezoid<double>>(Point<double>(1e7, 1e-7), 6.0, 4.0, 2.0));
+    figures.push_back(std::make_shared<Rhombus<double>>(Point<double>(0.0, 0.0), 3.0, 1.0));
+    
+    FigureFormatter<double> formatter;
+    for (size_t i = 0; i < figures.size(); ++i) {
+        std::ostringstream expected;
+        expected << *figures[i];
+        EXPECT_EQ(formatter.to_string(*figures[i]), expected.str());
+    }
+    
+    std::ostringstream expected;
+    expected << "[" << *figures[0] << ", " << *figures[1] << ", " << *figures[2] << "]";
+    std::string out;
+    formatter.append(out, figures);
+    EXPECT_EQ(out, expected.str());
+    
+    Rhombus<float> rhombus(Point<float>(0.1f, 0.2f), 3.3f, 1.7f);
+    Rectangle<int> rectangle(Point<int>(5, -7), 4, 6);
+    std::ostringstream float_stream;
+    std::ostringstream int_stream;
+    float_stream << rhombus;
+    int_stream << rectangle;
+    EXPECT_EQ(FigureFormatter<float>().to_string(rhombus), float_stream.str());
+    EXPECT_EQ(FigureFormatter<int>().to_string(rectangle), int_stream.str());
+}
+
+TEST(FigureFormatterTest, CompactLayouts) {
+    Rectangle<double> rectangle(Point<double>(0.5, 1.0), 1.0, 2.0);
+    
+    FigureFormatter<double> csv(FigureFormat::Csv);
+    std::string out;
+    csv.append_header(out);
+    csv.append(out, rectangle);
+    EXPECT_EQ(out, "kind,center_x,center_y,area,x1,y1,x2,y2,x3,y3,x4,y4\n"
+                   "rectangle,0.5,1,2,0,0,1,0,1,2,0,2\n");
+    
+    FigureFormatter<double> json(FigureFormat::JsonLines);
+    EXPECT_EQ(json.to_string(rectangle), 
+              "{\"kind\":\"rectangle\",\"center\":[0.5,1],\"area\":2,\"vertices\":[[0,0],[1,0],[1,2],[0,2]]}\n");
+    
+    Rhombus<double> thirds(Point<double>(1.0 / 3.0, 0.0), 2.0, 2.0);
+    std::string record = csv.to_string(thirds);
+    double center_x = 0.0;
+    std::from_chars(record.data() + 8, record.data() + record.size(), center_x);
+    EXPECT_EQ(center_x, thirds.center().x());
+    
+    FigureStore<double> store;
+    store.push_back(rectangle);
+    store.push_back(thirds);
+    std::string from_store;
+    std::string from_figures = json.to_string(rectangle) + json.to_string(thirds);
+    json.append(from_store, store);
+    EXPECT_EQ(from_store, from_figures);
+}
+
+TEST(FigureWriterTest, FlushesToFileDescriptor) {
+    std::string path = (std::filesystem::temp_directory_path() / 
+                        ("figures_writer_" + std::to_string(::getpid()) + ".jsonl")).string();
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    ASSERT_GE(fd, 0);
+    
+    Array<std::shared_ptr<Figure<int>>> figures;
+    std::string expected;
+    FigureFormatter<int> formatter(FigureFormat::JsonLines);
+    for (int i = 0; i < 500; ++i) {
+        figures.push_back(std::make_shared<Rectangle<int>>(Point<int>(i, -i), 2, 4));
+        expected += formatter.to_string(*figures[i]);
+    }
+    
+    {
+        FigureWriter<int> writer(fd, FigureFormat::JsonLines, 256);
+        writer.write(figures);
+        EXPECT_GT(writer.bytes_written(), 0);
+        EXPECT_LT(writer.buffered(), 512);
+    }
+    ::close(fd);
+    
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    std::filesystem::remove(path);
+    EXPECT_EQ(contents.str(), expected);
+}
+
+TEST(FigureWriterTest, HumanArrayStaysWithinBuffer) {
+    std::string path = (std::filesystem::temp_directory_path() / 
+                        ("figures_writer_human_" + std::to_string(::getpid()) + ".txt")).string();
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    ASSERT_GE(fd, 0);
+    
+    Array<std::shared_ptr<Figure<int>>> figures;
+    for (int i = 0; i < 500; ++i) {
+        figures.push_back(std::make_shared<Rectangle<int>>(Point<int>(i, -i), 2, 4));
+    }
+    std::string expected;
+    FigureFormatter<int>().append(expected, figures);
+    expected += '\n';
+    
+    {
+        FigureWriter<int> writer(fd, FigureFormat::Human, 256);
+        writer.write(figures);
+        EXPECT_GT(writer.bytes_written(), expected.size() / 2);
+        EXPECT_LT(writer.buffered(), 512);
+    }
+    ::close(fd);
+    
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    std::filesystem::remove(path);
+    EXPECT_EQ(contents.str(), expected);
+}
+
+TEST(FigureCacheTest, RepeatedQueriesHitCache) {
+    Rectangle<double> rectangle(Point<double>(1.0, 2.0), 4.0, 3.0);
+    FigureCacheCounters::reset();
+    
+    EXPECT_DOUBLE_EQ(rectangle.area(), 12.0);
+    EXPECT_DOUBLE_EQ(rectangle.area(), 12.0);
+    EXPECT_DOUBLE_EQ(static_cast<double>(rectangle), 12.0);
+    EXPECT_EQ(rectangle.center(), Point<double>(1.0, 2.0));
+    EXPECT_EQ(rectangle.center(), Point<double>(1.0, 2.0));
+    EXPECT_EQ(rectangle.bounding_box(), BoundingBox<double>(-1.0, 0.5, 3.0, 3.5));
+    EXPECT_EQ(rectangle.bounding_box(), BoundingBox<double>(-1.0, 0.5, 3.0, 3.5));
+    
+    FigureCacheStats stats = FigureCacheCounters::snapshot();
+    EXPECT_EQ(stats.misses, 3);
+    EXPECT_EQ(stats.hits, 4);
+    EXPECT_DOUBLE_EQ(stats.hit_rate(), 4.0 / 7.0);
+}
+
+TEST(FigureCacheTest, CopyKeepsCacheAndAssignmentInvalidates) {
+    Rhombus<double> source(Point<double>(0.0, 0.0), 6.0, 4.0);
+    source.area();
+    
+    FigureCacheCounters::reset();
+    Rhombus<double> copy(source);
+    EXPECT_DOUBLE_EQ(copy.area(), 12.0);
+    EXPECT_EQ(FigureCacheCounters::snapshot().hits, 1);
+    
+    Rhombus<double> target(Point<double>(5.0, 5.0), 2.0, 2.0);
+    EXPECT_DOUBLE_EQ(target.area(), 2.0);
+    EXPECT_EQ(target.center(), Point<double>(5.0, 5.0));
+    
+    FigureCacheCounters::reset();
+    target = source;
+    EXPECT_DOUBLE_EQ(target.area(), 12.0);
+    EXPECT_EQ(target.center(), Point<double>(0.0, 0.0));
+    EXPECT_EQ(FigureCacheCounters::snapshot().misses, 2);
+    
+    Rhombus<double> moved_into(Point<double>(9.0, 9.0), 2.0, 2.0);
+    moved_into.area();
+    moved_into = Rhombus<double>(Point<double>(0.0, 0.0), 2.0, 8.0);
+    EXPECT_DOUBLE_EQ(moved_into.area(), 8.0);
+}
+
+TEST(FigureCacheTest, ConcurrentReadersAgree) {
+    Array<std::shared_ptr<Figure<double>>> figures;
+    for (int i = 0; i < 1000; ++i) {
+        figures.push_back(std::make_shared<Trapezoid<double>>(Point<double>(i, -i), 6.0 + i % 5, 4.0, 2.0));
+    }
+    
+    std::vector<std::vector<double>> seen(4, std::vector<double>(figures.size()));
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < seen.size(); ++t) {
+        readers.emplace_back([&figures, &seen, t] {
+            for (size_t i = 0; i < figures.size(); ++i) {
+                seen[t][i] = figures[i]->area() + figures[i]->center().x() + figures[i]->bounding_box().width();
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    
+    for (size_t t = 1; t < seen.size(); ++t) {
+        EXPECT_EQ(seen[t], seen[0]);
+    }
+    EXPECT_DOUBLE_EQ(figures[3]->area(), (9.0 + 4.0) * 2.0 / 2.0);
+}
+
+TEST(FigureCacheTest, CountersDoNotLoseSharedShardIncrements) {
+    Rectangle<double> rectangle(Point<double>(1.0, 2.0), 4.0, 3.0);
+    rectangle.area();
+    FigureCacheCounters::reset();
+    
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 130; ++t) {
+        readers.emplace_back([&rectangle] {
+            for (int i = 0; i < 1000; ++i) {
+                rectangle.area();
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    
+    FigureCacheStats stats = FigureCacheCounters::snapshot();
+    EXPECT_EQ(stats.hits, 130000);
+    EXPECT_EQ(stats.misses, 0);
+}
+
+TEST(FigureCacheTest, VariantAreaBypassesCache) {
+    FigureVariant<double> variant(Rectangle<double>(Point<double>(1.0, 2.0), 4.0, 3.0));
+    FigureCacheCounters::reset();
+    
+    EXPECT_DOUBLE_EQ(variant.area(), 12.0);
+    EXPECT_DOUBLE_EQ(variant.area(), 12.0);
+    
+    FigureCacheStats stats = FigureCacheCounters::snapshot();
+    EXPECT_EQ(stats.hits, 0);
+    EXPECT_EQ(stats.misses, 0);
+}
+
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+    size_t deallocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+TEST(FigureArenaTest, BuildsBatchWithFewUpstreamAllocations) {
+    CountingResource upstream;
+    {
+        FigureArena<double> arena(4096, &upstream);
+        auto figures = arena.make_array<std::shared_ptr<Figure<double>>>();
+        double expected = 0.0;
+        for (int i = 0; i < 3000; ++i) {
+            if (i % 2 == 0) {
+                figures.push_back(arena.make_shared<Rectangle<double>>(Point<double>(i, i), 2.0, 3.0));
+                expected += 6.0;
+            } else {
+                figures.push_back(arena.make_shared<Rhombus<double>>(Point<double>(i, -i), 4.0, 2.0));
+                expected += 4.0;
+            }
+        }
+        
+        EXPECT_EQ(arena.created(), 3000);
+        EXPECT_EQ(figures.get_allocator().resource(), arena.resource());
+        double total = 0.0;
+        for (size_t i = 0; i < figures.size(); ++i) {
+            total += figures[i]->area();
+        }
+        EXPECT_DOUBLE_EQ(total, expected);
+        EXPECT_LT(upstream.allocations, 40);
+    }
+    EXPECT_EQ(upstream.deallocations, upstream.allocations);
+}
+
+TEST(FigureArenaTest, RawFiguresReleasedAtOnce) {
+    CountingResource upstream;
+    FigureArena<int> arena(1024, &upstream);
+    auto figures = arena.make_array<Figure<int>*>();
+    for (int i = 0; i < 100; ++i) {
+        figures.push_back(arena.create<Trapezoid<int>>(Point<int>(i, 0), 6, 4, 2));
+    }
+    EXPECT_EQ(figures[42]->area(), 10.0);
+    EXPECT_EQ(figures[42]->center(), Point<int>(42, 0));
+    
+    figures.clear();
+    arena.release();
+    EXPECT_EQ(arena.created(), 0);
+    EXPECT_EQ(upstream.deallocations, upstream.allocations);
+    
+    Rectangle<int>* rectangle = arena.create<Rectangle<int>>(Point<int>(0, 0), 2, 2);
+    EXPECT_EQ(rectangle->area(), 4.0);
+}
+
+struct CountedRectangle : Rectangle<double> {
+    static inline int destroyed = 0;
+    
+    using Rectangle<double>::Rectangle;
+    
+    ~CountedRectangle() override {
+        ++destroyed;
+    }
+};
+
+TEST(FigureArenaTest, ReleaseRunsDestructorsAndRefusesLiveHandles) {
+    CountedRectangle::destroyed = 0;
+    {
+        FigureArena<double> arena(1024);
+        for (int i = 0; i < 3; ++i) {
+            arena.create<CountedRectangle>(Point<double>(i, 0), 2.0, 2.0);
+        }
+        arena.release();
+        EXPECT_EQ(CountedRectangle::destroyed, 3);
+        
+        std::shared_ptr<CountedRectangle> handle = arena.make_shared<CountedRectangle>(Point<double>(0, 0), 2.0, 3.0);
+        EXPECT_EQ(arena.live_shared(), 1);
+        EXPECT_THROW(arena.release(), std::logic_error);
+        EXPECT_DOUBLE_EQ(handle->area(), 6.0);
+        
+        std::shared_ptr<Figure<double>> copy = handle;
+        handle.reset();
+        EXPECT_EQ(CountedRectangle::destroyed, 3);
+        copy.reset();
+        EXPECT_EQ(CountedRectangle::destroyed, 4);
+        EXPECT_EQ(arena.live_shared(), 0);
+        arena.release();
+        
+        arena.create<CountedRectangle>(Point<double>(0, 0), 1.0, 1.0);
+    }
+    EXPECT_EQ(CountedRectangle::destroyed, 5);
+}
+
+TEST(ConstexprGeometryTest, PointIsUsableInConstantExpressions) {
+    constexpr Point<double> a(0.0, 0.0);
+    constexpr Point<double> b(3.0, 4.0);
+    static_assert(a.distance(b) == 5.0);
+    static_assert(a + b == Point<double>(3.0, 4.0));
+    static_assert(b - b == a);
+    
+    constexpr Point<int> ai(1, 1);
+    constexpr Point<int> bi(4, 5);
+    static_assert(ai.distance(bi) == 5.0);
+    
+    EXPECT_DOUBLE_EQ(a.distance(b), 5.0);
+}
+
+TEST(ConstexprGeometryTest, ShapesAreEvaluatedAtCompileTime) {
+    constexpr RectangleValue<double> rect(Point<double>(0.0, 0.0), 4.0, 2.0);
+    static_assert(rect.area() == 8.0);
+    static_assert(rect.width() == 4.0 && rect.height() == 2.0);
+    static_assert(rect.center() == Point<double>(0.0, 0.0));
+    static_assert(rect.bounding_box() == BoundingBox<double>(-2.0, -1.0, 2.0, 1.0));
+    static_assert(RectangleValue<double>::is_valid(rect.vertices()));
+    
+    constexpr TrapezoidValue<int> trap(0, 0, 4, 0, 3, 2, 1, 2);
+    static_assert(trap.area() == 6.0);
+    static_assert(trap.base1() == 4 && trap.base2() == 2 && trap.height() == 2);
+    
+    constexpr RhombusValue<double> rhomb(Point<double>(1.0, 1.0), 6.0, 8.0);
+    static_assert(rhomb.area() == 24.0);
+    static_assert(rhomb.side() == 5.0);
+    static_assert(RhombusValue<double>::is_valid(rhomb.vertices()));
+    
+    constexpr RectangleValue<double>::Vertices skewed{Point<double>(0, 0), Point<double>(4, 0),
+                                                      Point<double>(3, 2), Point<double>(1, 2)};
+    static_assert(!RectangleValue<double>::is_valid(skewed));
+    static_assert(!TrapezoidValue<double>::is_valid(rhomb.vertices()));
+    
+    EXPECT_EQ(rect.kind, FigureKind::Rectangle);
+}
+
+TEST(ConstexprGeometryTest, CompileTimeTables) {
+    constexpr auto table = [] {
+        std::array<RectangleValue<int>, 4> rects;
+        for (int i = 0; i < 4; ++i) {
+            rects[i] = RectangleValue<int>(Point<int>(i * 10, 0), 2 * (i + 1), 2);
+        }
+        return rects;
+    }();
+    
+    constexpr double total = [&table] {
+        double sum = 0.0;
+        for (const auto& rect : table) {
+            sum += rect.area();
+        }
+        return sum;
+    }();
+    static_assert(total == 4.0 + 8.0 + 12.0 + 16.0);
+    static_assert(table[3].bounding_box().max_x() == 34);
+    
+    EXPECT_DOUBLE_EQ(total, 40.0);
+}
+
+TEST(ConstexprGeometryTest, InvalidValuesThrowAtRuntime) {
+    EXPECT_THROW(RectangleValue<double>(Point<double>(0, 0), -1.0, 2.0), std::invalid_argument);
+    EXPECT_THROW(RectangleValue<double>(0, 0, 4, 0, 3, 2, 1, 2), std::invalid_argument);
+    EXPECT_THROW(TrapezoidValue<double>(0, 0, 4, 1, 3, 2, 1, 2), std::invalid_argument);
+    EXPECT_THROW(RhombusValue<double>(0, 0, 4, 0, 4, 2, 0, 2), std::invalid_argument);
+    EXPECT_THROW(RectangleValue<double>().get_vertex(4), std::out_of_range);
+}
+
+TEST(ConstexprGeometryTest, ConvertsToAndFromRuntimeShapes) {
+    constexpr RectangleValue<double> rect_value(Point<double>(1.0, 2.0), 3.0, 5.0);
+    Rectangle<double> rect(rect_value);
+    EXPECT_DOUBLE_EQ(rect.area(), rect_value.area());
+    EXPECT_EQ(rect.center(), rect_value.center());
+    EXPECT_EQ(rect.bounding_box(), rect_value.bounding_box());
+    EXPECT_EQ(rect.value(), rect_value);
+    
+    Trapezoid<double> trap(Point<double>(0.0, 0.0), 6.0, 2.0, 3.0);
+    TrapezoidValue<double> trap_value = trap.value();
+    EXPECT_DOUBLE_EQ(trap_value.area(), trap.area());
+    EXPECT_EQ(Trapezoid<double>(trap_value).value(), trap_value);
+    
+    Rhombus<int> rhomb(Point<int>(0, 0), 4, 2);
+    RhombusValue<int> rhomb_value = rhomb.value();
+    EXPECT_DOUBLE_EQ(rhomb_value.area(), rhomb.area());
+    EXPECT_EQ(rhomb_value.center(), rhomb.center());
+    
+    Trapezoid<int> thin(Point<int>(0, 0), 4, 2, 1);
+    EXPECT_DOUBLE_EQ(thin.value().area(), thin.area());
+    
+    Array<std::shared_ptr<Figure<double>>> figures;
+    figures.push_back(std::make_shared<Rectangle<double>>(rect_value));
+    EXPECT_DOUBLE_EQ(figures[0]->area(), 15.0);
+}
+
+TEST(ConcurrentArrayTest, SegmentsKeepReferencesStable) {
+    ConcurrentArray<int, 4> values;
+    const int* first = nullptr;
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(values.push_back(i), static_cast<size_t>(i));
+        if (i == 0) {
+            first = &values[0];
+        }
+    }
+    
+    EXPECT_EQ(values.size(), 1000u);
+    EXPECT_GE(values.capacity(), 1000u);
+    EXPECT_EQ(first, &values[0]);
+    EXPECT_EQ(values.at(999), 999);
+    EXPECT_TRUE(values.published(999));
+    EXPECT_FALSE(values.published(1000));
+    EXPECT_THROW(values.at(1000), std::out_of_range);
+    EXPECT_THROW(values[1000], std::out_of_range);
+    EXPECT_THROW(values[1u << 20], std::out_of_range);
+    
+    Array<int> frozen = values.freeze();
+    ASSERT_EQ(frozen.size(), 1000u);
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(frozen[i], i);
+    }
+}
+
+TEST(ConcurrentArrayTest, ConcurrentProducersAndReader) {
+    const size_t producers = 4;
+    const size_t per_producer = 20000;
+    ConcurrentArray<size_t, 16> values;
+    std::atomic<bool> done{false};
+    
+    std::thread reader([&] {
+        while (!done.load()) {
+            size_t seen = 0;
+            values.for_each([&seen](size_t value) {
+                EXPECT_LT(value, producers * per_producer);
+                ++seen;
+            });
+            EXPECT_LE(seen, producers * per_producer);
+        }
+    });
+    
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < producers; ++t) {
+        threads.emplace_back([&values, t, per_producer] {
+            for (size_t i = 0; i < per_producer; ++i) {
+                values.push_back(t * per_producer + i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    done.store(true);
+    reader.join();
+    
+    ASSERT_EQ(values.size(), producers * per_producer);
+    Array<size_t> frozen = values.freeze();
+    std::sort(frozen.data(), frozen.data() + frozen.size());
+    for (size_t i = 0; i < frozen.size(); ++i) {
+        ASSERT_EQ(frozen[i], i);
+    }
+}
+
+TEST(ConcurrentArrayTest, MovingFreezeTransfersFigures) {
+    ConcurrentArray<std::shared_ptr<Figure<double>>> figures(100);
+    for (int i = 0; i < 100; ++i) {
+        figures.emplace_back(std::make_shared<Rectangle<double>>(Point<double>(i, 0.0), 2.0, 3.0));
+    }
+    std::weak_ptr<Figure<double>> watched = figures[42];
+    
+    Array<std::shared_ptr<Figure<double>>> frozen = std::move(figures).freeze();
+    EXPECT_TRUE(figures.empty());
+    ASSERT_EQ(frozen.size(), 100u);
+    EXPECT_EQ(watched.use_count(), 1);
+    EXPECT_DOUBLE_EQ(frozen[42]->area(), 6.0);
+    
+    frozen.clear();
+    EXPECT_TRUE(watched.expired());
+}
+
+TEST(ValidityBitmapTest, SetTestAndVisit) {
+    ValidityBitmap bits(130);
+    EXPECT_EQ(bits.words(), 3u);
+    EXPECT_EQ(bits.count(), 0u);
+    
+    bits.set(0);
+    bits.set(64);
+    bits.set(129);
+    EXPECT_TRUE(bits.test(64));
+    EXPECT_FALSE(bits.test(65));
+    EXPECT_EQ(bits.count(), 3u);
+    EXPECT_THROW(bits.test(130), std::out_of_range);
+    
+    std::vector<size_t> visited;
+    bits.for_each_set([&visited](size_t index) { visited.push_back(index); });
+    EXPECT_EQ(visited, (std::vector<size_t>{0, 64, 129}));
+    
+    bits.set(64, false);
+    bits.resize(100);
+    EXPECT_EQ(bits.count(), 1u);
+}
+
+static std::vector<double> make_candidate_quads(FigureKind kind, size_t count, std::mt19937& rng) {
+    std::uniform_real_distribution<double> coordinate(-1000.0, 1000.0);
+    std::uniform_real_distribution<double> extent(0.5, 50.0);
+    std::vector<double> coordinates;
+    coordinates.reserve(count * 8);
+    
+    for (size_t i = 0; i < count; ++i) {
+        Point<double> center(coordinate(rng), coordinate(rng));
+        QuadValue<double>::Vertices vertices;
+        switch (kind) {
+            case FigureKind::Rectangle:
+                vertices = RectangleValue<double>(center, extent(rng), extent(rng)).vertices();
+                break;
+            case FigureKind::Trapezoid:
+                vertices = TrapezoidValue<double>(center, extent(rng), extent(rng), extent(rng)).vertices();
+                break;
+            case FigureKind::Rhombus:
+                vertices = RhombusValue<double>(center, extent(rng), extent(rng)).vertices();
+                break;
+        }
+        if (i % 3 == 1) {
+            vertices[2] = Point<double>(vertices[2].x() + 0.25, vertices[2].y() + 0.5);
+        }
+        for (const Point<double>& vertex : vertices) {
+            coordinates.push_back(vertex.x());
+            coordinates.push_back(vertex.y());
+        }
+    }
+    return coordinates;
+}
+
+TEST(FigureBatchTest, ValidationMatchesScalarConstructors) {
+    std::mt19937 rng(20);
+    for (FigureKind kind : {FigureKind::Rectangle, FigureKind::Trapezoid, FigureKind::Rhombus}) {
+        std::vector<double> coordinates = make_candidate_quads(kind, 1003, rng);
+        ValidityBitmap simd = batch_validate<double>(kind, coordinates);
+        ValidityBitmap scalar = batch_validate<double>(kind, coordinates, SimdLevel::Scalar);
+        ASSERT_EQ(simd.size(), 1003u);
+        
+        for (size_t i = 0; i < simd.size(); ++i) {
+            const double* c = coordinates.data() + i * 8;
+            bool constructed = true;
+            try {
+                switch (kind) {
+                    case FigureKind::Rectangle:
+                        Rectangle<double>(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7]);
+                        break;
+                    case FigureKind::Trapezoid:
+                        Trapezoid<double>(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7]);
+                        break;
+                    case FigureKind::Rhombus:
+                        Rhombus<double>(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7]);
+                        break;
+                }
+            } catch (const std::invalid_argument&) {
+                constructed = false;
+            }
+            EXPECT_EQ(simd[i], constructed) << "figure " << i;
+            EXPECT_EQ(scalar[i], simd[i]) << "figure " << i;
+        }
+    }
+}
+
+TEST(FigureBatchTest, AppendsOnlyValidFigures) {
+    std::mt19937 rng(21);
+    std::vector<double> coordinates = make_candidate_quads(FigureKind::Rectangle, 300, rng);
+    
+    FigureStore<double> store;
+    ValidityBitmap valid = batch_append(FigureKind::Rectangle, coordinates, store);
+    EXPECT_EQ(valid.count(), 200u);
+    ASSERT_EQ(store.size(), valid.count());
+    
+    Array<std::shared_ptr<Figure<double>>> figures;
+    batch_append(FigureKind::Rectangle, coordinates, figures);
+    ASSERT_EQ(figures.size(), store.size());
+    
+    size_t next = 0;
+    valid.for_each_set([&](size_t index) {
+        const double* c = coordinates.data() + index * 8;
+        Rectangle<double> expected(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7]);
+        EXPECT_DOUBLE_EQ(store.area(next), expected.area());
+        EXPECT_DOUBLE_EQ(figures[next]->area(), expected.area());
+        EXPECT_EQ(figures[next]->center(), expected.center());
+        ++next;
+    });
+    
+    EXPECT_TRUE(batch_validate(store.columns()).all());
+    EXPECT_THROW(batch_validate<double>(FigureKind::Rectangle, std::span<const double>(coordinates.data(), 7)),
+                 std::invalid_argument);
+}
+
+TEST(FigureBatchTest, IntegerCoordinates) {
+    std::vector<int> coordinates = {0, 0, 4, 0, 4, 2, 0, 2,
+                                    0, 0, 4, 0, 3, 2, 0, 2,
+                                    0, 2, 3, 0, 0, -2, -3, 0};
+    ValidityBitmap rectangles = batch_validate<int>(FigureKind::Rectangle, coordinates);
+    EXPECT_TRUE(rectangles[0]);
+    EXPECT_FALSE(rectangles[1]);
+    
+    FigureStore<int> store;
+    ValidityBitmap rhombi = batch_append(FigureKind::Rhombus, std::span<const int>(coordinates).subspan(16), store);
+    EXPECT_TRUE(rhombi.all());
+    EXPECT_EQ(store.kind(0), FigureKind::Rhombus);
+    EXPECT_DOUBLE_EQ(store.area(0), 12.0);
+}
+
+TEST(FigureBatchTest, NearToleranceQuadsRoundTripThroughConstructors) {
+    std::vector<double> coordinates = {0, 0, 1e6, 0, 1e6, 1000000.0001, 0, 1e6,
+                                       0, 0, 1e6, 0, 1e6, 1000000.01, 0, 1e6};
+    FigureStore<double> store;
+    ValidityBitmap valid = batch_append(FigureKind::Rectangle, coordinates, store);
+    EXPECT_TRUE(valid[0]);
+    EXPECT_FALSE(valid[1]);
+    EXPECT_EQ(valid[0], batch_validate<double>(FigureKind::Rectangle, coordinates, SimdLevel::Scalar)[0]);
+    
+    const double* c = coordinates.data();
+    EXPECT_NO_THROW(Rectangle<double>(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7]));
+    c += 8;
+    EXPECT_THROW(Rectangle<double>(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7]), std::invalid_argument);
+    
+    ASSERT_EQ(store.size(), 1u);
+    Array<std::shared_ptr<Figure<double>>> restored = store.to_array();
+    ASSERT_EQ(restored.size(), 1u);
+    EXPECT_EQ(restored[0]->get_vertex(2), Point<double>(1e6, 1000000.0001));
+    EXPECT_NO_THROW(store.make_figure(0));
+}
+
+TEST(ExactGeometryTest, IntegralScalarSelection) {
+    static_assert(IntegralScalar<int> && IntegralScalar<short> && IntegralScalar<unsigned>);
+    static_assert(!IntegralScalar<double> && !IntegralScalar<bool> && !IntegralScalar<long long>);
+    static_assert(std::is_same_v<ExactWide<short>, std::int64_t>);
+    
+    constexpr std::array<Point<int>, 4> square = {Point<int>(0, 0), Point<int>(2, 1), Point<int>(1, 3), Point<int>(-1, 2)};
+    static_assert(twice_signed_area<int>(square) == 10);
+    static_assert(exact_area<int>(square) == 5.0);
+    SUCCEED();
+}
+
+TEST(ExactGeometryTest, RotatedIntegerFiguresAreExact) {
+    Rectangle<int> square(0, 0, 2, 1, 1, 3, -1, 2);
+    EXPECT_EQ(square.area(), 5.0);
+    EXPECT_EQ(square.twice_signed_area(), 10);
+    
+    Rhombus<int> rhombus(0, 3, 4, 0, 0, -3, -4, 0);
+    EXPECT_EQ(rhombus.area(), 24.0);
+    EXPECT_EQ(rhombus.twice_signed_area(), -48);
+    
+    Trapezoid<int> trapezoid(0, 0, 5, 0, 4, 3, 1, 3);
+    EXPECT_EQ(trapezoid.area(), 12.0);
+    
+    FigureStore<int> store;
+    store.push_back(square);
+    store.push_back(rhombus);
+    store.push_back(trapezoid);
+    EXPECT_EQ(store.area(0), 5.0);
+    EXPECT_EQ(store.total_area(), 41.0);
+}
+
+TEST(ExactGeometryTest, ExtremeCoordinatesDoNotOverflow) {
+    const int lo = std::numeric_limits<int>::min();
+    const int hi = std::numeric_limits<int>::max();
+    std::array<Point<int>, 4> box = {Point<int>(lo, lo), Point<int>(hi, lo), Point<int>(hi, hi), Point<int>(lo, hi)};
+    
+    __int128 side = static_cast<__int128>(hi) - lo;
+    EXPECT_TRUE(twice_signed_area<int>(box) == 2 * side * side);
+    EXPECT_EQ(exact_area<int>(box), static_cast<double>(side * side));
+    
+    RationalPoint<int> center = exact_center<int>(box);
+    EXPECT_TRUE(center == (RationalPoint<int>{-1, -1, 2}));
+    EXPECT_EQ(exact_bounding_box<int>(box), BoundingBox<int>(lo, lo, hi, hi));
+}
+
+TEST(ExactGeometryTest, ExtremeFiguresValidateWithoutOverflow) {
+    const int lo = std::numeric_limits<int>::min();
+    const int hi = std::numeric_limits<int>::max();
+    EXPECT_DOUBLE_EQ(Point<int>(lo, 0).distance(Point<int>(hi, 0)), 4294967295.0);
+    EXPECT_NE(Point<int>(lo, 0), Point<int>(hi, 0));
+    
+    Rectangle<int> box(lo, lo, hi, lo, hi, hi, lo, hi);
+    EXPECT_EQ(box.area(), 4294967295.0 * 4294967295.0);
+    EXPECT_NO_THROW(Rhombus<int>(0, hi, hi, 0, 0, -hi, -hi, 0));
+}
+
+TEST(ExactGeometryTest, CrossedTrapezoidOrderIsRejected) {
+    EXPECT_THROW(Trapezoid<int>(0, 0, 4, 0, 0, 2, 4, 2), std::invalid_argument);
+    EXPECT_THROW(Trapezoid<double>(0, 0, 4, 0, 0, 2, 4, 2), std::invalid_argument);
+    std::vector<double> coordinates = {0, 0, 4, 0, 0, 2, 4, 2, 0, 0, 4, 0, 4, 2, 0, 2};
+    ValidityBitmap simd = batch_validate<double>(FigureKind::Trapezoid, coordinates);
+    ValidityBitmap scalar = batch_validate<double>(FigureKind::Trapezoid, coordinates, SimdLevel::Scalar);
+    EXPECT_FALSE(simd[0]);
+    EXPECT_FALSE(scalar[0]);
+    EXPECT_TRUE(simd[1]);
+    EXPECT_TRUE(scalar[1]);
+    
+    Trapezoid<int> exact(0, 0, 4, 0, 4, 2, 0, 2);
+    Trapezoid<double> floating(0, 0, 4, 0, 4, 2, 0, 2);
+    EXPECT_EQ(exact.area(), 8.0);
+    EXPECT_EQ(exact.area(), floating.area());
+}
+
+TEST(ExactGeometryTest, CrossedRectangleOrderIsRejected) {
+    EXPECT_THROW(Rectangle<int>(0, 0, 4, 0, 0, 3, 4, 3), std::invalid_argument);
+    EXPECT_THROW(Rectangle<double>(0, 0, 4, 0, 0, 3, 4, 3), std::invalid_argument);
+    EXPECT_THROW(Rectangle<int>(0, 0, 1, 0, 1, 0, 0, 0), std::invalid_argument);
+    EXPECT_THROW(Rectangle<double>(0, 0, 1, 0, 1, 0, 0, 0), std::invalid_argument);
+    
+    std::vector<double> coordinates;
+    for (int repeat = 0; repeat < 2; ++repeat) {
+        coordinates.insert(coordinates.end(), {0, 0, 4, 0, 0, 3, 4, 3,
+                                               0, 0, 1, 0, 1, 0, 0, 0,
+                                               0, 0, 3, 4, -1, 7, -4, 3,
+                                               0, 0, 0, 3, 4, 3, 4, 0});
+    }
+    ValidityBitmap simd = batch_validate<double>(FigureKind::Rectangle, coordinates);
+    ValidityBitmap scalar = batch_validate<double>(FigureKind::Rectangle, coordinates, SimdLevel::Scalar);
+    ASSERT_EQ(simd.size(), 8u);
+    for (size_t i = 0; i < simd.size(); ++i) {
+        EXPECT_EQ(simd[i], i % 4 >= 2) << "figure " << i;
+        EXPECT_EQ(scalar[i], i % 4 >= 2) << "figure " << i;
+    }
+    
+    Rectangle<int> exact(0, 0, 3, 4, -1, 7, -4, 3);
+    Rectangle<double> floating(0, 0, 3, 4, -1, 7, -4, 3);
+    EXPECT_EQ(exact.area(), 25.0);
+    EXPECT_DOUBLE_EQ(exact.area(), floating.area());
+}
+
+TEST(ExactGeometryTest, ExactCenterKeepsFraction) {
+    Rectangle<int> unit(0, 0, 1, 0, 1, 1, 0, 1);
+    EXPECT_EQ(unit.center(), Point<int>(0, 0));
+    
+    RationalPoint<int> center = unit.exact_center();
+    EXPECT_TRUE(center == (RationalPoint<int>{1, 1, 2}));
+    EXPECT_EQ(center.to_point(), Point<double>(0.5, 0.5));
+}
+
+TEST(PolygonTest, TriangleAndHexagon) {
+    Polygon<double> triangle{Point<double>(0, 0), Point<double>(4, 0), Point<double>(0, 3)};
+    EXPECT_EQ(triangle.vertex_count(), 3);
+    EXPECT_DOUBLE_EQ(triangle.area(), 6.0);
+    EXPECT_EQ(triangle.centroid(), Point<double>(4.0 / 3.0, 1.0));
+    EXPECT_TRUE(triangle.is_convex());
+    
+    std::vector<Point<double>> ring;
+    for (int i = 0; i < 6; ++i) {
+        double angle = i * std::numbers::pi / 3.0;
+        ring.emplace_back(10.0 + 2.0 * std::cos(angle), -5.0 + 2.0 * std::sin(angle));
+    }
+    Polygon<double, 8> hexagon(ring);
+    EXPECT_NEAR(hexagon.area(), 6.0 * std::sqrt(3.0), 1e-12);
+    EXPECT_EQ(hexagon.centroid(), Point<double>(10.0, -5.0));
+    EXPECT_GT(hexagon.twice_signed_area(), 0.0);
+}
+
+TEST(PolygonTest, MomentsMatchAcrossSimdLevels) {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> radius(50.0, 100.0);
+    for (size_t count : {3, 4, 5, 7, 8, 17, 64}) {
+        std::vector<Point<double>> ring;
+        for (size_t i = 0; i < count; ++i) {
+            double angle = 2.0 * std::numbers::pi * static_cast<double>(i) / static_cast<double>(count);
+            double r = radius(rng);
+            ring.emplace_back(1000.0 + r * std::cos(angle), 2000.0 + r * std::sin(angle));
+        }
+        PolygonMoments scalar = polygon_moments<double>(ring, SimdLevel::Scalar);
+        PolygonMoments wide = polygon_moments<double>(ring, detected_simd_level());
+        EXPECT_NEAR(scalar.twice_area, wide.twice_area, 1e-9 * std::abs(scalar.twice_area));
+        EXPECT_NEAR(scalar.x, wide.x, 1e-9 * std::abs(scalar.twice_area) * 100.0);
+        EXPECT_NEAR(scalar.y, wide.y, 1e-9 * std::abs(scalar.twice_area) * 100.0);
+        
+        Polygon<double> polygon(ring);
+        EXPECT_NEAR(polygon.area(), std::abs(scalar.twice_area) / 2.0, 1e-9);
+    }
+}
+
+TEST(PolygonTest, ConvexityAndSimplicity) {
+    Polygon<int> arrow{Point<int>(0, 0), Point<int>(4, 2), Point<int>(0, 4), Point<int>(1, 2)};
+    EXPECT_FALSE(arrow.is_convex());
+    EXPECT_TRUE(arrow.is_simple());
+    EXPECT_EQ(arrow.area(), 6.0);
+    
+    Polygon<int> collinear{Point<int>(0, 0), Point<int>(2, 0), Point<int>(4, 0), Point<int>(4, 4), Point<int>(0, 4)};
+    EXPECT_TRUE(collinear.is_convex());
+    EXPECT_EQ(collinear.area(), 16.0);
+    
+    EXPECT_THROW((Polygon<int>{Point<int>(0, 0), Point<int>(2, 2), Point<int>(2, 0), Point<int>(0, 2)}),
+                 std::invalid_argument);
+    
+    std::vector<Point<double>> pentagram;
+    for (int i = 0; i < 5; ++i) {
+        double angle = (2 * i % 5) * 2.0 * std::numbers::pi / 5.0;
+        pentagram.emplace_back(std::cos(angle), std::sin(angle));
+    }
+    EXPECT_THROW(Polygon<double>{pentagram}, std::invalid_argument);
+    
+    EXPECT_THROW((Polygon<int>{Point<int>(0, 0), Point<int>(1, 1), Point<int>(2, 2)}), std::invalid_argument);
+    EXPECT_THROW((Polygon<int>{Point<int>(0, 0), Point<int>(4, 0), Point<int>(2, 0), Point<int>(2, 3)}),
+                 std::invalid_argument);
+}
+
+TEST(PolygonTest, VertexCountLimits) {
+    EXPECT_THROW((Polygon<int>{Point<int>(0, 0), Point<int>(1, 0)}), std::invalid_argument);
+    
+    std::vector<Point<int>> square = {Point<int>(0, 0), Point<int>(1, 0), Point<int>(1, 1), Point<int>(0, 1)};
+    EXPECT_THROW((Polygon<int, 3>(square)), std::invalid_argument);
+    EXPECT_NO_THROW((Polygon<int, 4>(square)));
+}
+
+TEST(PolygonTest, IntegerCentroidAndPolymorphism) {
+    Polygon<int> l_shape{Point<int>(0, 0), Point<int>(2, 0), Point<int>(2, 1), Point<int>(1, 1), Point<int>(1, 2), Point<int>(0, 2)};
+    EXPECT_EQ(l_shape.twice_signed_area(), 6);
+    EXPECT_EQ(l_shape.area(), 3.0);
+    EXPECT_EQ(l_shape.centroid(), Point<double>(5.0 / 6.0, 5.0 / 6.0));
+    
+    Array<std::shared_ptr<Figure<int>>> figures;
+    figures.push_back(std::make_shared<Polygon<int>>(l_shape));
+    figures.push_back(std::make_shared<Rectangle<int>>(0, 0, 2, 0, 2, 2, 0, 2));
+    double total = 0.0;
+    for (size_t i = 0; i < figures.size(); ++i) {
+        total += static_cast<double>(*figures[i]);
+    }
+    EXPECT_EQ(total, 7.0);
+    
+    Polygon<int> copy = l_shape;
+    EXPECT_TRUE(copy == l_shape);
+}
+
+TEST(AffineTransformTest, CompositionAndPivot) {
+    constexpr AffineTransform move = AffineTransform::translation(2.0, -1.0);
+    constexpr AffineTransform grow = AffineTransform::scaling(3.0);
+    static_assert(move.then(grow).apply(Point<double>(1.0, 1.0)) == Point<double>(9.0, 0.0));
+    static_assert(grow.then(move).apply(Point<double>(1.0, 1.0)) == Point<double>(5.0, 2.0));
+    static_assert(AffineTransform::identity().is_identity() && move.is_translation() && grow.is_axis_aligned());
+    static_assert(AffineTransform::scaling(2.0).about(Point<int>(1, 1)).apply(Point<int>(2, 3)) == Point<int>(3, 5));
+    
+    AffineTransform quarter = AffineTransform::rotation(std::numbers::pi / 2.0).about(Point<double>(1.0, 1.0));
+    EXPECT_EQ(quarter.apply(Point<double>(2.0, 1.0)), Point<double>(1.0, 2.0));
+    EXPECT_NEAR(quarter.determinant(), 1.0, 1e-12);
+    EXPECT_EQ(quarter.apply(Point<int>(3, 1)), Point<int>(1, 3));
+    EXPECT_EQ(AffineTransform::translation(-0.5, 0.5).apply(Point<int>(0, 0)), Point<int>(-1, 1));
+}
+
+TEST(AffineTransformTest, FigureTransformKeepsShapeAndInvalidatesCache) {
+    Rectangle<double> rectangle(Point<double>(0.0, 0.0), 4.0, 2.0);
+    EXPECT_DOUBLE_EQ(rectangle.area(), 8.0);
+    
+    rectangle.transform(AffineTransform::rotation(0.3).then(AffineTransform::translation(5.0, 5.0)));
+    EXPECT_NEAR(rectangle.area(), 8.0, 1e-9);
+    EXPECT_EQ(rectangle.center(), Point<double>(5.0, 5.0));
+    
+    rectangle.transform(AffineTransform::scaling(2.0).about(Point<double>(5.0, 5.0)));
+    EXPECT_NEAR(rectangle.area(), 32.0, 1e-9);
+    EXPECT_EQ(rectangle.center(), Point<double>(5.0, 5.0));
+    
+    Trapezoid<int> trapezoid(0, 0, 6, 0, 4, 2, 2, 2);
+    Trapezoid<int> original = trapezoid;
+    EXPECT_EQ(trapezoid.area(), 8.0);
+    EXPECT_FALSE(trapezoid.try_transform(AffineTransform::rotation(0.5)));
+    EXPECT_TRUE(trapezoid == original);
+    EXPECT_THROW(trapezoid.transform(AffineTransform::rotation(0.5)), std::invalid_argument);
+    
+    trapezoid.transform(AffineTransform::scaling(2.0, 3.0));
+    EXPECT_EQ(trapezoid.area(), 48.0);
+    EXPECT_EQ(trapezoid.bounding_box(), BoundingBox<int>(0, 0, 12, 6));
+    
+    Polygon<int> triangle{Point<int>(0, 0), Point<int>(4, 0), Point<int>(0, 4)};
+    EXPECT_FALSE(triangle.try_transform(AffineTransform::scaling(1.0, 0.0)));
+    EXPECT_EQ(triangle.area(), 8.0);
+}
+
+TEST(AffineTransformTest, BatchAffineMatchesScalar) {
+    std::vector<double> x(37), y(37);
+    for (size_t i = 0; i < x.size(); ++i) {
+        x[i] = static_cast<double>(i) * 1.5 - 20.0;
+        y[i] = 100.0 - static_cast<double>(i * i) * 0.25;
+    }
+    std::vector<double> scalar_x = x, scalar_y = y;
+    AffineTransform transform = AffineTransform::rotation(1.1).then(AffineTransform(2.0, 0.5, -0.25, 1.5, 3.0, -7.0));
+    
+    batch_affine(x.data(), y.data(), x.size(), transform);
+    batch_affine(scalar_x.data(), scalar_y.data(), scalar_x.size(), transform, SimdLevel::Scalar);
+    for (size_t i = 0; i < x.size(); ++i) {
+        EXPECT_DOUBLE_EQ(x[i], scalar_x[i]);
+        EXPECT_DOUBLE_EQ(y[i], scalar_y[i]);
+    }
+    
+    std::vector<float> fx = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f}, fy = {0.0f, 1.0f, 0.0f, 1.0f, 0.0f};
+    batch_affine(fx.data(), fy.data(), fx.size(), AffineTransform::translation(0.5, -1.0));
+    EXPECT_EQ(fx, (std::vector<float>{1.5f, 2.5f, 3.5f, 4.5f, 5.5f}));
+    EXPECT_EQ(fy, (std::vector<float>{-1.0f, 0.0f, -1.0f, 0.0f, -1.0f}));
+}
+
+TEST(AffineTransformTest, StoreTransformRejectsBrokenShapes) {
+    FigureStore<double> store;
+    for (int i = 0; i < 300; ++i) {
+        double offset = static_cast<double>(i);
+        if (i % 3 == 0) {
+            store.push_back(Trapezoid<double>(offset, 0, offset + 4, 0, offset + 3, 2, offset + 1, 2));
+        } else {
+            store.push_back(Rectangle<double>(Point<double>(offset, offset), 2.0, 1.0));
+        }
+    }
+    double before = store.total_area();
+    
+    ValidityBitmap moved = transform_figures(store, AffineTransform::translation(10.0, -10.0));
+    EXPECT_TRUE(moved.all());
+    EXPECT_EQ(store.center(7), Point<double>(17.0, -3.0));
+    
+    ValidityBitmap rotated = transform_figures(store, AffineTransform::rotation(0.25), SimdLevel::Scalar);
+    EXPECT_EQ(rotated.count(), 200);
+    EXPECT_FALSE(rotated[0]);
+    EXPECT_TRUE(rotated[1]);
+    EXPECT_EQ(store.get_vertex(0, 1), Point<double>(14.0, -10.0));
+    EXPECT_NEAR(store.total_area(), before, 1e-6);
+    
+    FigureStore<double> parallel;
+    for (int i = 0; i < 10000; ++i) {
+        parallel.push_back(Rhombus<double>(Point<double>(i, -i), 4.0, 2.0));
+    }
+    ThreadPool pool(4);
+    ValidityBitmap scaled = transform_figures(parallel, AffineTransform::scaling(0.5).then(AffineTransform::rotation(2.0)), pool, 100);
+    EXPECT_TRUE(scaled.all());
+    EXPECT_NEAR(parallel.total_area(), 10000 * 1.0, 1e-6);
+}
+
+TEST(AffineTransformTest, OutOfRangeIntegralResultsAreRejected) {
+    EXPECT_TRUE(AffineTransform::representable<unsigned>(-0.4));
+    EXPECT_FALSE(AffineTransform::representable<unsigned>(-10.0));
+    EXPECT_FALSE(AffineTransform::representable<int>(std::numeric_limits<double>::quiet_NaN()));
+    EXPECT_FALSE(AffineTransform::representable<int>(3e9));
+    EXPECT_EQ(AffineTransform::convert<unsigned>(-10.0), 0u);
+    EXPECT_EQ(AffineTransform::convert<int>(std::numeric_limits<double>::infinity()), std::numeric_limits<int>::max());
+    
+    Rectangle<unsigned> rectangle(Point<unsigned>(2, 1), 4, 2);
+    Rectangle<unsigned> original = rectangle;
+    EXPECT_FALSE(rectangle.try_transform(AffineTransform::translation(-10.0, 0.0)));
+    EXPECT_TRUE(rectangle == original);
+    EXPECT_THROW(rectangle.transform(AffineTransform::translation(-10.0, 0.0)), std::invalid_argument);
+    EXPECT_FALSE(rectangle.try_transform(AffineTransform::scaling(std::numeric_limits<double>::quiet_NaN())));
+    EXPECT_TRUE(rectangle == original);
+    
+    FigureStore<unsigned> store;
+    for (unsigned i = 0; i < 130; ++i) {
+        store.push_back(Rectangle<unsigned>(Point<unsigned>(i % 20 + 2, 5), 4, 2));
+    }
+    ValidityBitmap moved = transform_figures(store, AffineTransform::translation(-10.0, 1.0));
+    for (size_t i = 0; i < store.size(); ++i) {
+        EXPECT_EQ(moved[i], i % 20 >= 10);
+        unsigned x = static_cast<unsigned>(i % 20);
+        EXPECT_EQ(store.get_vertex(i, 0), moved[i] ? Point<unsigned>(x - 10, 5) : Point<unsigned>(x, 4));
+    }
+    
+    FigureStore<int> wide;
+    wide.push_back(Rectangle<int>(Point<int>(0, 0), 4, 2));
+    wide.push_back(Rectangle<int>(Point<int>(std::numeric_limits<int>::max() - 8, 0), 4, 2));
+    Point<int> corner = wide.get_vertex(1, 0);
+    ValidityBitmap scaled = transform_figures(wide, AffineTransform::scaling(2.0), SimdLevel::Scalar);
+    EXPECT_TRUE(scaled[0]);
+    EXPECT_FALSE(scaled[1]);
+    EXPECT_EQ(wide.get_vertex(1, 0), corner);
+}
+
+TEST(AffineTransformTest, ArrayTransformInParallel) {
+    Array<std::shared_ptr<Figure<int>>> figures;
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 2 == 0) {
+            figures.push_back(std::make_shared<Rectangle<int>>(Point<int>(i, i), 4, 2));
+        } else {
+            figures.push_back(std::make_shared<Trapezoid<int>>(0, 0, 6, 0, 4, 2, 2, 2));
+        }
+    }
+    for (size_t i = 0; i < figures.size(); ++i) {
+        figures[i]->area();
+    }
+    
+    ThreadPool pool(4);
+    ValidityBitmap moved = transform_figures(figures, AffineTransform::translation(3.0, 4.0), pool, 64);
+    EXPECT_TRUE(moved.all());
+    EXPECT_EQ(figures[2]->center(), Point<int>(5, 6));
+    
+    ValidityBitmap turned = transform_figures(figures, AffineTransform::rotation(std::numbers::pi / 2.0));
+    EXPECT_EQ(turned.count(), 500);
+    EXPECT_EQ(figures[0]->bounding_box(), BoundingBox<int>(-5, 1, -3, 5));
+    EXPECT_EQ(figures[0]->area(), 8.0);
+    EXPECT_EQ(figures[1]->center(), Point<int>(6, 5));
+}
+
+TEST(SweepAndPruneTest, CandidatesMatchBruteForce) {
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<double> coordinate(0.0, 200.0);
+    std::uniform_real_distribution<double> extent(0.5, 8.0);
+    std::vector<BoundingBox<double>> boxes;
+    for (int i = 0; i < 500; ++i) {
+        double x = coordinate(rng), y = coordinate(rng);
+        boxes.emplace_back(x, y, x + extent(rng), y + extent(rng));
+    }
+    boxes.push_back(boxes[3]);
+    
+    std::vector<FigurePair> expected;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        for (size_t j = i + 1; j < boxes.size(); ++j) {
+            if (boxes[i].intersects(boxes[j])) {
+                expected.push_back(FigurePair{i, j});
+            }
+        }
+    }
+    
+    SweepAndPrune<double> broad_phase;
+    broad_phase.update(boxes);
+    std::vector<FigurePair> serial = broad_phase.candidate_pairs();
+    std::sort(serial.begin(), serial.end());
+    EXPECT_EQ(serial, expected);
+    
+    ThreadPool pool(4);
+    std::vector<FigurePair> parallel = broad_phase.candidate_pairs(pool, 37);
+    EXPECT_EQ(parallel, broad_phase.candidate_pairs());
+    EXPECT_THROW(broad_phase.box(boxes.size()), std::out_of_range);
+    
+    std::vector<BoundingBox<double>> column;
+    for (const BoundingBox<double>& box : boxes) {
+        column.emplace_back(box.min_y() / 10.0, box.min_x() * 10.0, box.max_y() / 10.0, box.max_x() * 10.0);
+    }
+    broad_phase.update(column);
+    std::vector<FigurePair> transposed = broad_phase.candidate_pairs();
+    std::sort(transposed.begin(), transposed.end());
+    EXPECT_EQ(transposed, expected);
+}
+
+TEST(SweepAndPruneTest, IncrementalUpdateOnSmallMoves) {
+    FigureStore<double> store;
+    for (int i = 0; i < 1000; ++i) {
+        store.push_back(RectangleValue<double>(Point<double>(i * 1.5, (i % 10) * 3.0), 2.0, 2.0));
+    }
+    SweepAndPrune<double> broad_phase(store);
+    EXPECT_TRUE(broad_phase.last_resorted());
+    
+    transform_figures(store, AffineTransform::translation(0.1, 0.0));
+    broad_phase.update(store);
+    EXPECT_FALSE(broad_phase.last_resorted());
+    EXPECT_EQ(broad_phase.last_moves(), 0);
+    
+    Array<std::shared_ptr<Figure<double>>> figures = store.to_array();
+    for (size_t i = 0; i < figures.size(); i += 2) {
+        figures[i]->transform(AffineTransform::translation(2.0, 0.0));
+    }
+    SweepAndPrune<double> incremental(store);
+    incremental.update(figures);
+    EXPECT_FALSE(incremental.last_resorted());
+    EXPECT_GT(incremental.last_moves(), 0);
+    
+    std::vector<FigurePair> moved = incremental.candidate_pairs();
+    std::vector<FigurePair> fresh = SweepAndPrune<double>(figures).candidate_pairs();
+    std::sort(moved.begin(), moved.end());
+    std::sort(fresh.begin(), fresh.end());
+    EXPECT_EQ(moved, fresh);
+    
+    std::vector<BoundingBox<double>> reversed;
+    for (size_t i = 0; i < figures.size(); ++i) {
+        reversed.push_back(figures[figures.size() - 1 - i]->bounding_box());
+    }
+    incremental.update(reversed);
+    EXPECT_TRUE(incremental.last_resorted());
+}
+
+TEST(FigureCollisionTest, SeparatingAxisNarrowPhase) {
+    Rhombus<int> diamond(0, 2, 2, 0, 0, -2, -2, 0);
+    Rectangle<int> corner(1, 1, 3, 1, 3, 3, 1, 3);
+    Rectangle<int> touching(1, 1, 3, -1, 5, 1, 3, 3);
+    EXPECT_TRUE(diamond.bounding_box().intersects(corner.bounding_box()));
+    EXPECT_TRUE(convex_overlap<int>(diamond, corner));
+    EXPECT_TRUE(convex_overlap<int>(diamond, touching));
+    
+    Rectangle<int> gap(2, 1, 4, 1, 4, 3, 2, 3);
+    EXPECT_TRUE(diamond.bounding_box().intersects(gap.bounding_box()));
+    EXPECT_FALSE(convex_overlap<int>(diamond, gap));
+    
+    const int big = std::numeric_limits<int>::max() - 1;
+    Rectangle<int> far_left(RectangleValue<int>::from_validated(
+        {Point<int>(-big, -big), Point<int>(0, -big), Point<int>(0, big), Point<int>(-big, big)}));
+    Rectangle<int> far_right(RectangleValue<int>::from_validated(
+        {Point<int>(1, -big), Point<int>(big, -big), Point<int>(big, big), Point<int>(1, big)}));
+    EXPECT_FALSE(convex_overlap<int>(far_left, far_right));
+    
+    Rectangle<double> tilted(Point<double>(0.0, 0.0), 4.0, 1.0);
+    tilted.transform(AffineTransform::rotation(std::numbers::pi / 4.0));
+    Rectangle<double> near_corner(Point<double>(1.9, -1.9), 1.0, 1.0);
+    EXPECT_TRUE(tilted.bounding_box().intersects(near_corner.bounding_box()));
+    EXPECT_FALSE(convex_overlap<double>(tilted, near_corner));
+    EXPECT_TRUE(convex_overlap<double>(tilted, Rectangle<double>(Point<double>(1.0, 1.0), 1.0, 1.0)));
+}
+
+TEST(FigureCollisionTest, OverlappingPairsMatchBruteForce) {
+    std::mt19937 rng(29);
+    std::uniform_real_distribution<double> coordinate(0.0, 100.0);
+    std::uniform_real_distribution<double> angle(0.0, std::numbers::pi);
+    FigureStore<double> store;
+    for (int i = 0; i < 400; ++i) {
+        Point<double> center(coordinate(rng), coordinate(rng));
+        RectangleValue<double> value(center, 6.0, 1.0);
+        Rectangle<double> rectangle(value);
+        rectangle.transform(AffineTransform::rotation(angle(rng)).about(center));
+        if (i % 4 == 0) {
+            store.push_back(RhombusValue<double>(center, 4.0, 2.0));
+        } else {
+            store.push_back(rectangle);
+        }
+    }
+    Array<std::shared_ptr<Figure<double>>> figures = store.to_array();
+    
+    std::vector<FigurePair> expected;
+    for (size_t i = 0; i < figures.size(); ++i) {
+        for (size_t j = i + 1; j < figures.size(); ++j) {
+            if (convex_overlap<double>(*figures[i], *figures[j])) {
+                expected.push_back(FigurePair{i, j});
+            }
+        }
+    }
+    
+    SweepAndPrune<double> broad_phase(figures);
+    std::vector<FigurePair> candidates = broad_phase.candidate_pairs();
+    std::vector<FigurePair> from_array = overlapping_pairs(figures, broad_phase);
+    EXPECT_LT(from_array.size(), candidates.size());
+    std::sort(from_array.begin(), from_array.end());
+    EXPECT_EQ(from_array, expected);
+    
+    ThreadPool pool(3);
+    std::vector<FigurePair> from_store = overlapping_pairs(store, broad_phase, pool, 50);
+    std::sort(from_store.begin(), from_store.end());
+    EXPECT_EQ(from_store, expected);
+}
+
+TEST(ArrayIteratorTest, RandomAccessAndConst) {
+    using Numbers = Array<int>;
+    static_assert(std::random_access_iterator<Numbers::iterator>);
+    static_assert(std::random_access_iterator<Numbers::const_iterator>);
+    static_assert(std::is_same_v<decltype(*std::declval<const Numbers&>().begin()), const int&>);
+    
+    Numbers numbers;
+    for (int value : {5, 3, 9, 1, 7}) {
+        numbers.push_back(value);
+    }
+    std::sort(numbers.begin(), numbers.end());
+    EXPECT_EQ(numbers[0], 1);
+    EXPECT_EQ(numbers[4], 9);
+    
+    const Numbers& view = numbers;
+    Numbers::const_iterator first = view.begin();
+    EXPECT_EQ(view.end() - first, 5);
+    EXPECT_EQ(first[2], 5);
+    EXPECT_EQ(*(first + 3), 7);
+    EXPECT_TRUE(first < view.end());
+    EXPECT_EQ(std::lower_bound(view.begin(), view.end(), 6) - view.begin(), 3);
+    
+    Numbers::const_iterator converted = numbers.begin() + 1;
+    EXPECT_TRUE(converted == view.begin() + 1);
+    EXPECT_EQ(std::accumulate(numbers.cbegin(), numbers.cend(), 0), 25);
+    
+    Numbers::iterator last = numbers.end();
+    --last;
+    EXPECT_EQ(*last, 9);
+}
+
+TEST(FigureRankingTest, SortedOrderMatchesStableSort) {
+    std::vector<double> keys = {3.5, -1.0, 0.0, 2.0, -0.0, 3.5, -7.25, 1e300, -1e-300, 2.0};
+    ThreadPool pool(4);
+    
+    std::vector<size_t> expected(keys.size());
+    std::iota(expected.begin(), expected.end(), size_t(0));
+    std::stable_sort(expected.begin(), expected.end(), [&](size_t a, size_t b) { return keys[a] < keys[b]; });
+    EXPECT_EQ(sorted_order(keys, pool), expected);
+    
+    std::stable_sort(expected.begin(), expected.end(), [&](size_t a, size_t b) { return keys[a] > keys[b]; });
+    EXPECT_EQ(sorted_order(keys, pool, SortOrder::Descending), expected);
+    
+    std::mt19937 rng(41);
+    std::uniform_real_distribution<double> value(-1000.0, 1000.0);
+    std::vector<double> many(200000);
+    for (double& key : many) {
+        key = std::round(value(rng) * 4.0) / 4.0;
+    }
+    std::vector<size_t> order = sorted_order(many, pool);
+    std::vector<size_t> reference(many.size());
+    std::iota(reference.begin(), reference.end(), size_t(0));
+    std::stable_sort(reference.begin(), reference.end(), [&](size_t a, size_t b) { return many[a] < many[b]; });
+    EXPECT_EQ(order, reference);
+    
+    std::vector<size_t> nth = nth_order(many, 123456, pool);
+    EXPECT_EQ(many[nth[123456]], many[reference[123456]]);
+    for (size_t i = 0; i < nth.size(); i += 97) {
+        EXPECT_EQ(i < 123456 ? many[nth[i]] <= many[nth[123456]] : many[nth[i]] >= many[nth[123456]], true);
+    }
+    
+    std::vector<size_t> top = top_k_order(many, 10, pool);
+    ASSERT_EQ(top.size(), 10);
+    for (size_t i = 0; i < top.size(); ++i) {
+        EXPECT_EQ(many[top[i]], many[reference[reference.size() - 1 - i]]);
+    }
+    EXPECT_THROW(nth_order(many, many.size(), pool), std::out_of_range);
+    EXPECT_TRUE(top_k_order(many, 0, pool).empty());
+}
+
+TEST(FigureRankingTest, SortsAndRanksFigures) {
+    Array<std::shared_ptr<Figure<double>>> figures;
+    FigureStore<double> store;
+    for (int i = 0; i < 50; ++i) {
+        double side = 1.0 + (i * 37 % 50);
+        Rectangle<double> rectangle(Point<double>(100.0 - i, i * 2.0), side, 1.0);
+        figures.push_back(std::make_shared<Rectangle<double>>(rectangle));
+        store.push_back(rectangle);
+    }
+    ThreadPool pool(3);
+    
+    EXPECT_EQ(figure_keys(store, FigureKey::Area, pool), figure_keys(figures, FigureKey::Area, pool));
+    EXPECT_EQ(figure_keys(store, FigureKey::CenterY, pool), figure_keys(figures, FigureKey::CenterY, pool));
+    
+    Array<std::shared_ptr<Figure<double>>> top = top_k_figures(figures, 3, FigureKey::Area, pool);
+    ASSERT_EQ(top.size(), 3);
+    EXPECT_DOUBLE_EQ(top[0]->area(), 50.0);
+    EXPECT_DOUBLE_EQ(top[2]->area(), 48.0);
+    
+    nth_figure(figures, 10, FigureKey::Area, pool);
+    EXPECT_DOUBLE_EQ(figures[10]->area(), 11.0);
+    
+    sort_figures(figures, FigureKey::CenterX, pool);
+    EXPECT_TRUE(std::is_sorted(figures.begin(), figures.end(), [](const auto& a, const auto& b) {
+        return a->center().x() < b->center().x();
+    }));
+    
+    sort_figures(figures, FigureKey::Area, pool, SortOrder::Descending);
+    for (size_t i = 0; i < figures.size(); ++i) {
+        EXPECT_DOUBLE_EQ(figures[i]->area(), 50.0 - static_cast<double>(i));
+    }
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();